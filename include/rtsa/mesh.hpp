@@ -4,6 +4,7 @@
 #include <vector>
 #include <array>
 #include <memory>
+#include <string>
 
 namespace rtsa {
 
@@ -16,6 +17,11 @@ struct Mesh {
 
     // Build a unit cube centered at origin (12 triangles)
     static Mesh unitCube();
+
+    // Load vertices and faces from a Wavefront OBJ file. Polygons are fan
+    // triangulated; texture/normal references are ignored. Returns false if
+    // the file cannot be read or a face references a missing vertex.
+    static bool loadObj(const std::string& path, Mesh& out);
 };
 
 } // namespace rtsa
@@ -0,0 +1,61 @@
+#pragma once
+#include "mesh.hpp"
+#include "vec3.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtsa {
+
+// One level of a LOD chain. `maxDeviation` is the largest distance between
+// this level's surface and the full-resolution surface, measured both ways
+// from points sampled over the faces (vertices, edges and interiors), so the
+// silhouette of this level lies within about `maxDeviation` of the original.
+struct MeshLod {
+    Mesh mesh;
+    double maxDeviation{};
+};
+
+struct MeshLodOptions {
+    double reductionRatio = 0.5;   // triangle budget of each level relative to the previous one
+    std::size_t minTriangles = 8;  // stop once a level would drop below this many triangles
+    std::size_t maxLevels = 8;     // including the full-resolution level 0
+};
+
+// Chain of progressively simplified meshes built with quadric-error edge
+// collapse (Garland & Heckbert). Level 0 is always the input mesh unchanged;
+// deviations are non-decreasing along the chain.
+class MeshLodChain {
+public:
+    MeshLodChain() = default;
+
+    static MeshLodChain build(const Mesh& mesh, const MeshLodOptions& options = {});
+
+    std::size_t levelCount() const { return levels_.size(); }
+    const MeshLod& level(std::size_t i) const { return levels_[i]; }
+    const std::vector<MeshLod>& levels() const { return levels_; }
+
+    // Pick the coarsest level whose projected-area error along `windDir` is
+    // bounded by `areaTolerance`. The geometric bound is perimeter * d + pi * d^2
+    // with d = maxDeviation and the perimeter of the projected convex hull of
+    // the full mesh (exact for convex silhouettes). With `samples` > 0 the
+    // error of RayTracedShadowSamplerEstimator's samples x samples grid is
+    // charged to the same budget; 0 leaves it out. Returns 0 for an empty
+    // chain or an unreachable tolerance.
+    std::size_t selectLevel(const Vec3& windDir, double areaTolerance, uint32_t samples = 0) const;
+
+    // Same as above, valid for every direction at once: the projection is
+    // bounded by a disc whose diameter is the AABB diagonal.
+    std::size_t selectLevel(double areaTolerance, uint32_t samples = 0) const;
+
+    // Grid error alone at full resolution. When it exceeds the tolerance no
+    // level, not even 0, meets it at this `samples`.
+    double samplingError(const Vec3& windDir, uint32_t samples) const;
+    double samplingError(uint32_t samples) const;
+
+private:
+    std::vector<MeshLod> levels_;
+    double diagonal_{}; // AABB diagonal of the full-resolution mesh
+};
+
+} // namespace rtsa
@@ -1,5 +1,6 @@
 #pragma once
 #include "frontal_area_estimator.hpp"
+#include "mesh_lod.hpp"
 
 namespace rtsa {
 
@@ -11,6 +12,14 @@ public:
     double estimateFrontalArea(const Mesh& mesh,
                                const Vec3& windDir,
                                uint32_t samples) const override;
+
+    // Estimate using the coarsest level of `lods` whose silhouette deviation
+    // plus the error of a `samples` x `samples` grid keeps the area error
+    // along `windDir` within `areaTolerance` (see MeshLodChain::selectLevel).
+    double estimateFrontalArea(const MeshLodChain& lods,
+                               const Vec3& windDir,
+                               uint32_t samples,
+                               double areaTolerance) const;
 };
 
 } // namespace rtsa
@@ -0,0 +1,57 @@
+#pragma once
+#include "frontal_area_estimator.hpp"
+#include "sweep.hpp"
+#include "sweep_writer.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rtsa {
+
+// Multi-process sweeps. A coordinator splits every (mesh, direction range)
+// pair into work units and serves them over a Unix domain socket; worker
+// processes pull units, evaluate them and send the result blocks back.
+// Units are numbered mesh-major, direction-minor and written through a
+// SweepWriter in that order, so the merged rows are identical to a
+// single-process run no matter how many workers took part or failed.
+// POSIX only; on Windows both entry points report an error and return false.
+
+struct CoordinatorConfig {
+    std::string socketPath;
+    std::vector<std::string> meshPaths; // OBJ files; "" = built-in unit cube
+    SweepConfig sweep;                  // directions, samples, rho, Cd, speed
+    uint64_t unitRows = 256;            // directions per work unit
+    unsigned maxAttempts = 3;           // per unit, before the run is abandoned
+    // A worker holding a unit that sends no Progress heartbeat for this long
+    // is dropped and the unit retried. Workers beat every quarter of it, so
+    // slow units are fine as long as the worker is alive.
+    double unitTimeoutSec = 60.0;
+    double idleTimeoutSec = 30.0;       // give up if no worker is connected this long
+    double areaTol = 0.0;               // > 0: workers use the coarsest LOD valid for all directions
+    // Local worker processes started once the socket is listening. The
+    // command is run with execvp(); the run fails fast if all of them exit.
+    std::vector<std::string> workerCommand;
+    unsigned localWorkers = 0;
+};
+
+// Serve all work units until every result has been handed to `writer`.
+// Mesh paths are made absolute and checked for readability up front. The
+// socket path is only reused if it holds a stale socket. Returns false if a
+// unit exhausted its attempts, every local worker exited, or no worker was
+// connected for `idleTimeoutSec`. Does not call writer.finish().
+bool runCoordinator(const CoordinatorConfig& config, SweepWriter& writer);
+
+struct WorkerConfig {
+    std::string socketPath;
+    double connectTimeoutSec = 10.0; // keep retrying while the coordinator starts
+};
+
+// Pull and evaluate units until the coordinator says the sweep is done.
+// Returns false on connection or mesh loading errors.
+bool runWorker(const WorkerConfig& config, const FrontalAreaEstimator& estimator);
+
+// Path that re-executes the running binary, for CoordinatorConfig::workerCommand.
+// Uses /proc/self/exe where available, otherwise `argv0` for execvp().
+std::string currentExecutablePath(const char* argv0);
+
+} // namespace rtsa
@@ -0,0 +1,56 @@
+#pragma once
+#include "frontal_area_estimator.hpp"
+#include "mesh.hpp"
+#include "vec3.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rtsa {
+
+class SweepWriter;
+
+// Unit direction `index` of `count` spread near-uniformly over the sphere
+// (Fibonacci lattice). Deterministic, so any direction range can be
+// recomputed independently by another thread or process.
+Vec3 sphereDirection(uint64_t index, uint64_t count);
+
+struct SweepConfig {
+    uint64_t directions = 1000;
+    uint32_t samples = 256;
+    double rho = 1.225;
+    double Cd = 1.0;
+    double speed = 1.0;          // wind speed magnitude used for drag
+    unsigned threads = 0;        // 0 = std::thread::hardware_concurrency()
+    uint64_t blockRows = 1024;   // directions evaluated per work block
+};
+
+// Column-oriented batch of sweep results; all columns have the same length.
+struct SweepBlock {
+    std::vector<uint32_t> meshIndex;
+    std::vector<uint64_t> dirIndex;
+    std::vector<double> dirX, dirY, dirZ;
+    std::vector<double> area;
+    std::vector<double> drag;
+
+    std::size_t rows() const { return dirIndex.size(); }
+    void reserve(std::size_t n);
+};
+
+// Evaluate directions [begin, end) of a `config.directions`-point sweep on
+// the calling thread.
+SweepBlock evaluateDirections(const FrontalAreaEstimator& estimator,
+                              const Mesh& mesh,
+                              uint32_t meshIndex,
+                              uint64_t begin,
+                              uint64_t end,
+                              const SweepConfig& config);
+
+// Evaluate the whole sweep across `config.threads` workers, handing each
+// finished block to `writer` without waiting for it to reach disk.
+void runSweep(const FrontalAreaEstimator& estimator,
+              const Mesh& mesh,
+              uint32_t meshIndex,
+              const SweepConfig& config,
+              SweepWriter& writer);
+
+} // namespace rtsa
@@ -0,0 +1,94 @@
+#pragma once
+#include "sweep.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace rtsa {
+
+// Binary sweep file layout (little-endian; other hosts fail to compile):
+//   header : char[8] "RTSASWP1", uint32 version
+//   block* : uint64 rows, then each column contiguously:
+//            mesh_index u32[rows], dir_index u64[rows],
+//            dir_x f64[rows], dir_y f64[rows], dir_z f64[rows],
+//            area f64[rows], drag f64[rows]
+//   end    : uint64 0, written only when every block made it to disk, so a
+//            failed or abandoned run leaves a file readSweepFile rejects
+inline constexpr char kSweepMagic[8] = {'R','T','S','A','S','W','P','1'};
+inline constexpr uint32_t kSweepVersion = 1;
+inline constexpr std::size_t kSweepRowBytes = sizeof(uint32_t) + sizeof(uint64_t) + 5 * sizeof(double);
+
+// Streams SweepBlocks to a columnar binary file from a background thread.
+// submit() only moves the block into a queue, so compute threads never wait
+// on disk. Blocks are written in `sequence` order regardless of the order in
+// which they arrive, which keeps the output deterministic.
+// The queue and the reorder buffer are unbounded by design: a disk slower
+// than the compute threads grows memory (52 bytes per row) instead of
+// stalling them. Size runs or blockRows accordingly.
+// Only an explicit, successful finish() commits the file; destroying an
+// unfinished writer abandons it.
+class SweepWriter {
+public:
+    explicit SweepWriter(const std::string& path);
+    ~SweepWriter();
+
+    SweepWriter(const SweepWriter&) = delete;
+    SweepWriter& operator=(const SweepWriter&) = delete;
+
+    // False if the file could not be opened or a write failed.
+    bool ok() const;
+
+    // Queue `block` as the `sequence`-th block of the file. Sequences must be
+    // unique and, by the time finish() is called, contiguous from 0.
+    void submit(uint64_t sequence, SweepBlock block);
+
+    // Drain the queue, write the end marker and close the file. Returns
+    // false on I/O errors or if a sequence number is missing; the end
+    // marker is then left out so the file reads back as truncated.
+    bool finish();
+
+    // Stop without committing: queued blocks are dropped and no end marker
+    // is written, so the file reads back as truncated. Use when the
+    // producer failed. No-op after finish().
+    void abandon();
+
+    uint64_t rowsWritten() const;
+
+private:
+    bool close(bool commit);
+    void run();
+    void writeBlock(const SweepBlock& block);
+
+    std::ofstream out_;
+    std::thread thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::pair<uint64_t, SweepBlock>> queue_;
+    bool closing_ = false;
+    bool failed_ = false;
+    bool finished_ = false;
+
+    // Owned by the writer thread until it exits.
+    std::map<uint64_t, SweepBlock> pending_;
+    uint64_t nextSequence_ = 0;
+    std::atomic<uint64_t> rows_{0};
+};
+
+// Read every block of a sweep file in order. Returns false if the file is
+// missing, has a bad header, is truncated or claims more rows than it holds.
+bool readSweepFile(const std::string& path,
+                   const std::function<void(const SweepBlock&)>& onBlock);
+
+// Convert a binary sweep file to CSV with a header line.
+bool convertSweepToCsv(const std::string& binPath, const std::string& csvPath);
+
+} // namespace rtsa
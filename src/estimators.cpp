@@ -69,10 +69,11 @@ static SamplingSquare computeSamplingSquare(const Mesh& mesh, const Vec3& windDi
     Vec3 axis_u = temp.cross(u).normalized();
     Vec3 axis_v = u.cross(axis_u).normalized();
 
-    // Compute mesh centroid to align square center 'level' with mesh center
-    Vec3 centroid{0.0, 0.0, 0.0};
-    for (const auto& v : mesh.vertices) centroid = centroid + v;
-    centroid = centroid / static_cast<double>(mesh.vertices.size());
+    // Use the AABB center to align square center 'level' with mesh center.
+    // Unlike the vertex centroid it does not drift towards densely tessellated
+    // regions (e.g. simplified LOD meshes), and a square of side equal to the
+    // AABB diagonal around it always contains the whole projection.
+    Vec3 centroid = (minV + maxV) * 0.5;
 
     // Project centroid into plane coordinates relative to planePoint
     Vec3 dcent = centroid - planePoint;
@@ -122,11 +123,11 @@ static std::vector<Vec3> computeSamplingPoints(
     return samplePoints;
 }
 
-// Create rays originating from a single distant point such that the
-// direction from that origin to the plane center equals `windDir`.
-// Rays point toward each sample point on the plane.
-static std::vector<Ray> createRaysFromDistantPoint(
-    const SamplingSquare& plane,
+// Create rays parallel to `windDir`, one through each sample point, starting
+// `distance` upwind of the plane. This is the limit of casting from a single
+// infinitely distant point; doing that literally with a huge offset loses the
+// per-sample offsets to rounding for any direction not aligned with an axis.
+static std::vector<Ray> createParallelRays(
     const std::vector<Vec3>& points,
     const Vec3& windDir,
     double distance
@@ -135,14 +136,11 @@ static std::vector<Ray> createRaysFromDistantPoint(
     rays.reserve(points.size());
 
     Vec3 dir = windDir.normalized();
-    Vec3 origin = plane.center - dir * distance;
-
     for (const auto& p : points) {
-        Vec3 rd = (p - origin).normalized();
-        rays.push_back(Ray{origin, rd});
+        rays.push_back(Ray{p - dir * distance, dir});
     }
     return rays;
-};
+}
 
 static bool hitMeshBrute(const Ray& r, const Mesh& m, double tMin = 1e-6) {
     // Brute-force ray-triangle intersection using Möller–Trumbore.
@@ -207,8 +205,10 @@ double RayTracedShadowSamplerEstimator::estimateFrontalArea(
 ) const {
     auto plane = computeSamplingSquare(mesh, windDir);
     auto samplePoints = computeSamplingPoints(plane, samples);
-    auto farDist = 1e19;
-    auto rays = createRaysFromDistantPoint(plane, samplePoints, windDir, farDist);
+    // The plane sits on the downwind extreme of the mesh, so starting one
+    // full sampling-square side upwind clears the whole mesh depth.
+    double farDist = 2.0 * plane.halfSize + 1.0;
+    auto rays = createParallelRays(samplePoints, windDir, farDist);
     auto hits = countHits(rays, mesh);
     double planeLengthSide = plane.halfSize * 2.0;
     double planeSize = planeLengthSide * planeLengthSide;
@@ -217,4 +217,15 @@ double RayTracedShadowSamplerEstimator::estimateFrontalArea(
     return meshAreaEstimate;
 }
 
+double RayTracedShadowSamplerEstimator::estimateFrontalArea(
+    const MeshLodChain& lods,
+    const Vec3& windDir,
+    uint32_t samples,
+    double areaTolerance
+) const {
+    if (lods.levelCount() == 0) return 0.0;
+    const auto& lod = lods.level(lods.selectLevel(windDir, areaTolerance, samples));
+    return estimateFrontalArea(lod.mesh, windDir, samples);
+}
+
 } // namespace rtsa
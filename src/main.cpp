@@ -4,13 +4,18 @@
 #include <string>
 #include <sstream>
 #include <cstdlib>
+#include <fstream>
 
 #include "rtsa/vec3.hpp"
 #include "rtsa/mesh.hpp"
 #include "rtsa/mesh_object.hpp"
 #include "rtsa/world.hpp"
+#include "rtsa/mesh_lod.hpp"
 #include "rtsa/raytraced_shadow_sampler_estimator.hpp"
 #include "rtsa/aerodynamics.hpp"
+#include "rtsa/shard.hpp"
+#include "rtsa/sweep.hpp"
+#include "rtsa/sweep_writer.hpp"
 
 using namespace rtsa;
 
@@ -25,37 +30,117 @@ static bool parseVec3(int argc, char** argv, int& i, Vec3& out) {
 int main_cli(int argc, char** argv) {
     // Defaults
     std::string meshPath;
+    std::vector<std::string> meshPaths; // every --mesh / --mesh-list entry, for sharded sweeps
     uint32_t samples = 1024; // increase for better accuracy
     double rho = 1.225;
     double Cd = 1.0;
     Vec3 wind{1.0, 0.0, 0.0};
     int steps = 10;
     double dt = 0.1;
+    double areaTol = 0.0; // > 0 enables LOD selection
+    uint64_t sweepDirs = 0; // > 0 switches to direction-sweep mode
+    std::string outPath = "sweep.bin";
+    unsigned threads = 0;
+    bool coordinator = false;
+    bool worker = false;
+    std::string socketPath = "/tmp/rtsa-sweep.sock";
+    unsigned localWorkers = 0; // worker processes the coordinator spawns itself
+    uint64_t unitRows = 256;
+    double unitTimeout = 60.0; // seconds without a heartbeat before a unit is retried
 
     // Simple CLI parsing
     for (int i=1;i<argc;i++) {
         std::string a = argv[i];
-        if (a=="--mesh" && i+1<argc) meshPath = argv[++i];
+        if (a=="--mesh" && i+1<argc) { meshPath = argv[++i]; meshPaths.push_back(meshPath); }
+        else if (a=="--mesh-list" && i+1<argc) {
+            std::ifstream list(argv[++i]);
+            if (!list) { std::cerr << "Cannot read mesh list " << argv[i] << "\n"; return 1; }
+            // One path per line; surrounding blanks and CRLF endings are dropped.
+            for (std::string line; std::getline(list, line);) {
+                auto first = line.find_first_not_of(" \t\r");
+                if (first == std::string::npos) continue;
+                auto last = line.find_last_not_of(" \t\r");
+                meshPaths.push_back(line.substr(first, last - first + 1));
+            }
+        }
         else if (a=="--samples" && i+1<argc) samples = std::atoi(argv[++i]);
         else if (a=="--rho" && i+1<argc) rho = std::atof(argv[++i]);
         else if (a=="--cd" && i+1<argc) Cd = std::atof(argv[++i]);
         else if (a=="--wind") { if (!parseVec3(argc, argv, i, wind)) { std::cerr<<"Invalid --wind args\n"; return 1; } }
         else if (a=="--steps" && i+1<argc) steps = std::atoi(argv[++i]);
         else if (a=="--dt" && i+1<argc) dt = std::atof(argv[++i]);
+        else if (a=="--area-tol" && i+1<argc) areaTol = std::atof(argv[++i]);
+        else if (a=="--sweep" && i+1<argc) sweepDirs = std::strtoull(argv[++i], nullptr, 10);
+        else if (a=="--out" && i+1<argc) outPath = argv[++i];
+        else if (a=="--threads" && i+1<argc) threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (a=="--coordinator") coordinator = true;
+        else if (a=="--worker") worker = true;
+        else if (a=="--socket" && i+1<argc) socketPath = argv[++i];
+        else if (a=="--workers" && i+1<argc) localWorkers = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (a=="--unit-rows" && i+1<argc) unitRows = std::strtoull(argv[++i], nullptr, 10);
+        else if (a=="--unit-timeout" && i+1<argc) unitTimeout = std::atof(argv[++i]);
+        else if (a=="--to-csv" && i+2<argc) {
+            std::string binPath = argv[++i];
+            std::string csvPath = argv[++i];
+            if (!convertSweepToCsv(binPath, csvPath)) {
+                std::cerr << "Failed to convert " << binPath << " to " << csvPath << "\n";
+                return 1;
+            }
+            return 0;
+        }
         else { std::cerr << "Unknown arg: " << a << "\n"; }
     }
 
+    if (worker) {
+        WorkerConfig config;
+        config.socketPath = socketPath;
+        RayTracedShadowSamplerEstimator estimator;
+        return runWorker(config, estimator) ? 0 : 1;
+    }
+
+    if (coordinator) {
+        CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = meshPaths.empty() ? std::vector<std::string>{""} : meshPaths;
+        config.sweep.directions = sweepDirs > 0 ? sweepDirs : 1000;
+        config.sweep.samples = samples;
+        config.sweep.rho = rho;
+        config.sweep.Cd = Cd;
+        config.sweep.speed = wind.length();
+        config.unitRows = unitRows;
+        config.unitTimeoutSec = unitTimeout;
+        config.areaTol = areaTol;
+        config.workerCommand = {currentExecutablePath(argv[0]), "--worker", "--socket", socketPath};
+        config.localWorkers = localWorkers;
+
+        SweepWriter writer(outPath);
+        if (!writer.ok()) {
+            std::cerr << "Cannot open " << outPath << " for writing\n";
+            return 1;
+        }
+        // A failed run must not be committed, even if the blocks merged so
+        // far happen to be contiguous.
+        bool ok = runCoordinator(config, writer);
+        if (ok) ok = writer.finish();
+        else writer.abandon();
+        if (!ok) {
+            std::cerr << "Sharded sweep failed\n";
+            return 1;
+        }
+        std::cerr << "Wrote " << writer.rowsWritten() << " rows to " << outPath << "\n";
+        return 0;
+    }
+
     // Build world
     World world{WindField(wind)};
 
-    // Load mesh if provided (not implemented) else use unit cube.
-    std::shared_ptr<Mesh> meshPtr;
+    // Load mesh if provided else use unit cube.
+    std::shared_ptr<Mesh> meshPtr = std::make_shared<Mesh>();
     if (meshPath.empty()) {
-        meshPtr = std::make_shared<Mesh>(Mesh::unitCube());
-    } else {
-        // Mesh loading is out of scope for this skeleton. Future: implement OBJ/PLY loader.
-        std::cerr << "Mesh loading not implemented; using unit cube instead.\n";
-        meshPtr = std::make_shared<Mesh>(Mesh::unitCube());
+        *meshPtr = Mesh::unitCube();
+    } else if (!Mesh::loadObj(meshPath, *meshPtr)) {
+        std::cerr << "Cannot load mesh " << meshPath << "\n";
+        return 1;
     }
 
     auto obj = std::make_shared<MeshObject>(meshPtr);
@@ -63,6 +148,50 @@ int main_cli(int argc, char** argv) {
 
     RayTracedShadowSamplerEstimator estimator;
 
+    // Build the LOD chain once up front; the mesh is static for the whole run.
+    MeshLodChain lods;
+    if (areaTol > 0.0) {
+        lods = MeshLodChain::build(*meshPtr);
+        // Sweeps cover every direction, so they need the direction-free bound.
+        std::size_t level = sweepDirs > 0 ? lods.selectLevel(areaTol, samples)
+                                          : lods.selectLevel(wind.normalized(), areaTol, samples);
+        double gridError = sweepDirs > 0 ? lods.samplingError(samples)
+                                         : lods.samplingError(wind.normalized(), samples);
+        if (gridError > areaTol) {
+            std::cerr << "Warning: --samples " << samples << " alone may be off by " << gridError
+                      << " m^2, more than --area-tol " << areaTol << "\n";
+        }
+        std::cerr << "Using LOD " << level << " of " << lods.levelCount()
+                  << " (" << lods.level(level).mesh.indices.size() << " triangles, max deviation "
+                  << lods.level(level).maxDeviation << ")\n";
+    }
+
+    if (sweepDirs > 0) {
+        SweepConfig config;
+        config.directions = sweepDirs;
+        config.samples = samples;
+        config.rho = rho;
+        config.Cd = Cd;
+        config.speed = wind.length();
+        config.threads = threads;
+
+        const Mesh& sweepMesh = areaTol > 0.0
+            ? lods.level(lods.selectLevel(areaTol, samples)).mesh
+            : *meshPtr;
+        SweepWriter writer(outPath);
+        if (!writer.ok()) {
+            std::cerr << "Cannot open " << outPath << " for writing\n";
+            return 1;
+        }
+        runSweep(estimator, sweepMesh, 0, config, writer);
+        if (!writer.finish()) {
+            std::cerr << "Failed writing " << outPath << "\n";
+            return 1;
+        }
+        std::cerr << "Wrote " << writer.rowsWritten() << " rows to " << outPath << "\n";
+        return 0;
+    }
+
     // CSV header
     std::cout << "step,time,wind_x,wind_y,wind_z,area_est,drag_mag\n";
 
@@ -75,7 +204,9 @@ int main_cli(int argc, char** argv) {
         double v = w.length();
         const Mesh* m = obj->mesh();
 
-        double area = estimator.estimateFrontalArea(*m, w.normalized(), samples);
+        double area = areaTol > 0.0
+            ? estimator.estimateFrontalArea(lods, w.normalized(), samples, areaTol)
+            : estimator.estimateFrontalArea(*m, w.normalized(), samples);
         double drag = computeDragMagnitude(rho, Cd, v, area);
 
         std::cout << step << "," << time << "," << w.x << "," << w.y << "," << w.z
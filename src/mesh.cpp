@@ -1,4 +1,7 @@
 #include "rtsa/mesh.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
 
 namespace rtsa {
 
@@ -18,4 +21,39 @@ Mesh Mesh::unitCube() {
     return m;
 }
 
+bool Mesh::loadObj(const std::string& path, Mesh& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    Mesh m;
+    std::string line;
+    std::vector<int> polygon;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        std::string tag;
+        ls >> tag;
+        if (tag == "v") {
+            Vec3 v;
+            if (!(ls >> v.x >> v.y >> v.z)) return false;
+            m.vertices.push_back(v);
+        } else if (tag == "f") {
+            polygon.clear();
+            std::string ref;
+            while (ls >> ref) {
+                // "i", "i/t", "i//n" or "i/t/n"; negative indices count from the end
+                long idx = std::strtol(ref.c_str(), nullptr, 10);
+                long count = static_cast<long>(m.vertices.size());
+                if (idx < 0) idx += count + 1;
+                if (idx < 1 || idx > count) return false;
+                polygon.push_back(static_cast<int>(idx - 1));
+            }
+            for (std::size_t k = 2; k < polygon.size(); ++k) {
+                m.indices.push_back({polygon[0], polygon[k - 1], polygon[k]});
+            }
+        }
+    }
+    out = std::move(m);
+    return true;
+}
+
 } // namespace rtsa
@@ -0,0 +1,654 @@
+#include "rtsa/mesh_lod.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <queue>
+#include <utility>
+
+namespace rtsa {
+
+namespace {
+
+// Symmetric 4x4 error quadric stored as its upper triangle:
+// [a00 a01 a02 a03]
+// [    a11 a12 a13]
+// [        a22 a23]
+// [            a33]
+struct Quadric {
+    double a00{}, a01{}, a02{}, a03{};
+    double a11{}, a12{}, a13{};
+    double a22{}, a23{};
+    double a33{};
+
+    // Quadric of the plane n.p + d = 0 scaled by `w`. `n` must be unit length
+    // so that eval() returns squared distances.
+    static Quadric fromPlane(const Vec3& n, double d, double w) {
+        Quadric q;
+        q.a00 = w * n.x * n.x; q.a01 = w * n.x * n.y; q.a02 = w * n.x * n.z; q.a03 = w * n.x * d;
+        q.a11 = w * n.y * n.y; q.a12 = w * n.y * n.z; q.a13 = w * n.y * d;
+        q.a22 = w * n.z * n.z; q.a23 = w * n.z * d;
+        q.a33 = w * d * d;
+        return q;
+    }
+
+    Quadric& operator+=(const Quadric& o) {
+        a00 += o.a00; a01 += o.a01; a02 += o.a02; a03 += o.a03;
+        a11 += o.a11; a12 += o.a12; a13 += o.a13;
+        a22 += o.a22; a23 += o.a23;
+        a33 += o.a33;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& o) const {
+        Quadric q = *this;
+        q += o;
+        return q;
+    }
+
+    // Sum of weighted squared distances from p to the accumulated planes.
+    double eval(const Vec3& p) const {
+        return a00 * p.x * p.x + 2.0 * a01 * p.x * p.y + 2.0 * a02 * p.x * p.z + 2.0 * a03 * p.x
+             + a11 * p.y * p.y + 2.0 * a12 * p.y * p.z + 2.0 * a13 * p.y
+             + a22 * p.z * p.z + 2.0 * a23 * p.z
+             + a33;
+    }
+
+    // Solve grad eval(p) = 0 for the minimizing position. Returns false when
+    // the 3x3 system is (near) singular, e.g. for flat or straight regions.
+    bool optimum(Vec3& out) const {
+        double det = a00 * (a11 * a22 - a12 * a12)
+                   - a01 * (a01 * a22 - a12 * a02)
+                   + a02 * (a01 * a12 - a11 * a02);
+        double scale = std::abs(a00) + std::abs(a11) + std::abs(a22);
+        if (scale <= 0.0 || std::abs(det) <= 1e-12 * scale * scale * scale) return false;
+
+        // Cramer's rule on A p = -b
+        double bx = -a03, by = -a13, bz = -a23;
+        double dx = bx * (a11 * a22 - a12 * a12)
+                  - a01 * (by * a22 - a12 * bz)
+                  + a02 * (by * a12 - a11 * bz);
+        double dy = a00 * (by * a22 - a12 * bz)
+                  - bx * (a01 * a22 - a12 * a02)
+                  + a02 * (a01 * bz - by * a02);
+        double dz = a00 * (a11 * bz - by * a12)
+                  - a01 * (a01 * bz - by * a02)
+                  + bx * (a01 * a12 - a11 * a02);
+        out = Vec3{dx / det, dy / det, dz / det};
+        return true;
+    }
+};
+
+struct CollapseCandidate {
+    double cost;
+    int a;
+    int b;
+    uint32_t versionA;
+    uint32_t versionB;
+    Vec3 target;
+
+    bool operator>(const CollapseCandidate& o) const { return cost > o.cost; }
+};
+
+// Mutable working state for incremental edge-collapse decimation.
+class Decimator {
+public:
+    explicit Decimator(const Mesh& mesh) {
+        const std::size_t nv = mesh.vertices.size();
+        pos_ = mesh.vertices;
+        quadrics_.assign(nv, Quadric{});
+        vertexAlive_.assign(nv, false);
+        versions_.assign(nv, 0u);
+        vertexFaces_.assign(nv, {});
+
+        // Keep only well-formed faces; the estimator silently skips the rest too.
+        for (const auto& idx : mesh.indices) {
+            bool valid = true;
+            for (int k = 0; k < 3; ++k) {
+                if (idx[k] < 0 || static_cast<std::size_t>(idx[k]) >= nv) valid = false;
+            }
+            if (!valid || idx[0] == idx[1] || idx[1] == idx[2] || idx[0] == idx[2]) continue;
+            int f = static_cast<int>(faces_.size());
+            faces_.push_back(idx);
+            faceAlive_.push_back(true);
+            for (int k = 0; k < 3; ++k) {
+                vertexAlive_[static_cast<std::size_t>(idx[k])] = true;
+                vertexFaces_[static_cast<std::size_t>(idx[k])].push_back(f);
+            }
+        }
+        aliveFaces_ = faces_.size();
+
+        // Face plane quadrics. They only order the collapses; the error of each
+        // level is measured against the original surface afterwards.
+        std::map<std::pair<int,int>, std::pair<int,int>> edgeUse; // edge -> (count, face)
+        for (std::size_t f = 0; f < faces_.size(); ++f) {
+            const auto& idx = faces_[f];
+            Vec3 n = faceNormal(idx);
+            double len = n.length();
+            if (len > 0.0) {
+                n = n / len;
+                Quadric q = Quadric::fromPlane(n, -n.dot(pos_[static_cast<std::size_t>(idx[0])]), 1.0);
+                for (int k = 0; k < 3; ++k) quadrics_[static_cast<std::size_t>(idx[k])] += q;
+            }
+            for (int k = 0; k < 3; ++k) {
+                int v0 = idx[k];
+                int v1 = idx[(k + 1) % 3];
+                auto& use = edgeUse[{std::min(v0, v1), std::max(v0, v1)}];
+                use.first++;
+                use.second = static_cast<int>(f);
+            }
+        }
+
+        // Open boundaries form part of the silhouette of plates and shells, so
+        // pin them with planes perpendicular to the face through the edge.
+        for (const auto& [edge, use] : edgeUse) {
+            if (use.first != 1) continue;
+            const auto& idx = faces_[static_cast<std::size_t>(use.second)];
+            Vec3 n = faceNormal(idx).normalized();
+            const Vec3& p0 = pos_[static_cast<std::size_t>(edge.first)];
+            const Vec3& p1 = pos_[static_cast<std::size_t>(edge.second)];
+            Vec3 m = (p1 - p0).cross(n).normalized();
+            if (m.length() == 0.0) continue;
+            Quadric q = Quadric::fromPlane(m, -m.dot(p0), 1.0);
+            quadrics_[static_cast<std::size_t>(edge.first)] += q;
+            quadrics_[static_cast<std::size_t>(edge.second)] += q;
+        }
+
+        for (const auto& [edge, use] : edgeUse) {
+            pushCandidate(edge.first, edge.second);
+        }
+    }
+
+    std::size_t aliveFaces() const { return aliveFaces_; }
+
+    // Collapse edges in order of increasing quadric cost until at most
+    // `targetFaces` remain or no valid collapse is left.
+    void decimateTo(std::size_t targetFaces) {
+        while (aliveFaces_ > targetFaces && !heap_.empty()) {
+            CollapseCandidate c = heap_.top();
+            heap_.pop();
+            auto ua = static_cast<std::size_t>(c.a);
+            auto ub = static_cast<std::size_t>(c.b);
+            if (!vertexAlive_[ua] || !vertexAlive_[ub]) continue;
+            if (versions_[ua] != c.versionA || versions_[ub] != c.versionB) continue;
+            if (!canCollapse(c.a, c.b, c.target)) continue;
+            collapse(c.a, c.b, c.target);
+        }
+    }
+
+    Mesh snapshot() const {
+        Mesh m;
+        std::vector<int> remap(pos_.size(), -1);
+        for (std::size_t f = 0; f < faces_.size(); ++f) {
+            if (!faceAlive_[f]) continue;
+            std::array<int,3> tri{};
+            for (int k = 0; k < 3; ++k) {
+                auto v = static_cast<std::size_t>(faces_[f][k]);
+                if (remap[v] < 0) {
+                    remap[v] = static_cast<int>(m.vertices.size());
+                    m.vertices.push_back(pos_[v]);
+                }
+                tri[k] = remap[v];
+            }
+            m.indices.push_back(tri);
+        }
+        return m;
+    }
+
+private:
+    Vec3 faceNormal(const std::array<int,3>& idx) const {
+        const Vec3& v0 = pos_[static_cast<std::size_t>(idx[0])];
+        const Vec3& v1 = pos_[static_cast<std::size_t>(idx[1])];
+        const Vec3& v2 = pos_[static_cast<std::size_t>(idx[2])];
+        return (v1 - v0).cross(v2 - v0);
+    }
+
+    void pushCandidate(int a, int b) {
+        auto ua = static_cast<std::size_t>(a);
+        auto ub = static_cast<std::size_t>(b);
+        Quadric q = quadrics_[ua] + quadrics_[ub];
+        Vec3 target;
+        double cost = 0.0;
+        if (q.optimum(target)) {
+            cost = q.eval(target);
+        } else {
+            // Singular system: fall back to the best of the endpoints and midpoint.
+            const Vec3 options[3] = {pos_[ua], pos_[ub], (pos_[ua] + pos_[ub]) * 0.5};
+            target = options[0];
+            cost = q.eval(options[0]);
+            for (int k = 1; k < 3; ++k) {
+                double c = q.eval(options[k]);
+                if (c < cost) { cost = c; target = options[k]; }
+            }
+        }
+        heap_.push(CollapseCandidate{std::max(cost, 0.0), a, b, versions_[ua], versions_[ub], target});
+    }
+
+    void collectNeighbors(int v, std::vector<int>& out) const {
+        out.clear();
+        for (int f : vertexFaces_[static_cast<std::size_t>(v)]) {
+            if (!faceAlive_[static_cast<std::size_t>(f)]) continue;
+            for (int w : faces_[static_cast<std::size_t>(f)]) {
+                if (w != v) out.push_back(w);
+            }
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    bool canCollapse(int a, int b, const Vec3& target) {
+        // Link condition: the edge may only share as many neighbours as it has
+        // incident faces, otherwise the collapse pinches the surface.
+        collectNeighbors(a, neighborsA_);
+        collectNeighbors(b, neighborsB_);
+        std::size_t common = 0;
+        for (int w : neighborsA_) {
+            if (std::binary_search(neighborsB_.begin(), neighborsB_.end(), w)) common++;
+        }
+        std::size_t shared = 0;
+        for (int f : vertexFaces_[static_cast<std::size_t>(a)]) {
+            if (!faceAlive_[static_cast<std::size_t>(f)]) continue;
+            const auto& idx = faces_[static_cast<std::size_t>(f)];
+            if (idx[0] == b || idx[1] == b || idx[2] == b) shared++;
+        }
+        if (shared == 0 || common != shared) return false;
+
+        // Reject collapses that flip or flatten any surviving face.
+        for (int v : {a, b}) {
+            for (int f : vertexFaces_[static_cast<std::size_t>(v)]) {
+                if (!faceAlive_[static_cast<std::size_t>(f)]) continue;
+                const auto& idx = faces_[static_cast<std::size_t>(f)];
+                bool hasA = idx[0] == a || idx[1] == a || idx[2] == a;
+                bool hasB = idx[0] == b || idx[1] == b || idx[2] == b;
+                if (hasA && hasB) continue;
+
+                Vec3 p[3];
+                for (int k = 0; k < 3; ++k) {
+                    p[k] = (idx[k] == v) ? target : pos_[static_cast<std::size_t>(idx[k])];
+                }
+                Vec3 before = faceNormal(idx);
+                Vec3 after = (p[1] - p[0]).cross(p[2] - p[0]);
+                double afterLen = after.length();
+                if (afterLen <= 1e-12 * before.length()) return false;
+                if (before.dot(after) <= 0.0) return false;
+            }
+        }
+        return true;
+    }
+
+    void collapse(int a, int b, const Vec3& target) {
+        auto ua = static_cast<std::size_t>(a);
+        auto ub = static_cast<std::size_t>(b);
+
+        for (int f : vertexFaces_[ub]) {
+            auto uf = static_cast<std::size_t>(f);
+            if (!faceAlive_[uf]) continue;
+            auto& idx = faces_[uf];
+            if (idx[0] == a || idx[1] == a || idx[2] == a) {
+                faceAlive_[uf] = false;
+                aliveFaces_--;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (idx[k] == b) idx[k] = a;
+            }
+            vertexFaces_[ua].push_back(f);
+        }
+        vertexFaces_[ub].clear();
+        vertexAlive_[ub] = false;
+        versions_[ub]++;
+
+        // Drop references to faces that just died so adjacency stays short.
+        auto& fa = vertexFaces_[ua];
+        fa.erase(std::remove_if(fa.begin(), fa.end(),
+                                [this](int f) { return !faceAlive_[static_cast<std::size_t>(f)]; }),
+                 fa.end());
+
+        pos_[ua] = target;
+        quadrics_[ua] += quadrics_[ub];
+        versions_[ua]++;
+
+        collectNeighbors(a, neighborsA_);
+        for (int w : neighborsA_) pushCandidate(a, w);
+    }
+
+    std::vector<Vec3> pos_;
+    std::vector<Quadric> quadrics_;
+    std::vector<bool> vertexAlive_;
+    std::vector<uint32_t> versions_;
+    std::vector<std::vector<int>> vertexFaces_;
+    std::vector<std::array<int,3>> faces_;
+    std::vector<bool> faceAlive_;
+    std::size_t aliveFaces_{};
+    std::priority_queue<CollapseCandidate, std::vector<CollapseCandidate>, std::greater<>> heap_;
+    std::vector<int> neighborsA_;
+    std::vector<int> neighborsB_;
+};
+
+double computeAabbDiagonal(const Mesh& mesh) {
+    if (mesh.vertices.empty()) return 0.0;
+    Vec3 minV = mesh.vertices[0];
+    Vec3 maxV = mesh.vertices[0];
+    for (const auto& v : mesh.vertices) {
+        minV = Vec3{std::min(minV.x, v.x), std::min(minV.y, v.y), std::min(minV.z, v.z)};
+        maxV = Vec3{std::max(maxV.x, v.x), std::max(maxV.y, v.y), std::max(maxV.z, v.z)};
+    }
+    return (maxV - minV).length();
+}
+
+// Closest point on triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5).
+Vec3 closestPointOnTriangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) {
+    Vec3 ab = b - a, ac = c - a, ap = p - a;
+    double d1 = ab.dot(ap), d2 = ac.dot(ap);
+    if (d1 <= 0.0 && d2 <= 0.0) return a;
+
+    Vec3 bp = p - b;
+    double d3 = ab.dot(bp), d4 = ac.dot(bp);
+    if (d3 >= 0.0 && d4 <= d3) return b;
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) return a + ab * (d1 / (d1 - d3));
+
+    Vec3 cp = p - c;
+    double d5 = ab.dot(cp), d6 = ac.dot(cp);
+    if (d6 >= 0.0 && d5 <= d6) return c;
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) return a + ac * (d2 / (d2 - d6));
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    double denom = 1.0 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// Uniform grid over triangle bounding boxes answering "distance from p to
+// the nearest point of the surface" without scanning every triangle.
+class SurfaceDistance {
+public:
+    explicit SurfaceDistance(const Mesh& mesh) : mesh_{mesh} {
+        if (mesh.vertices.empty() || mesh.indices.empty()) return;
+        min_ = max_ = mesh.vertices[0];
+        for (const auto& v : mesh.vertices) {
+            min_ = Vec3{std::min(min_.x, v.x), std::min(min_.y, v.y), std::min(min_.z, v.z)};
+            max_ = Vec3{std::max(max_.x, v.x), std::max(max_.y, v.y), std::max(max_.z, v.z)};
+        }
+        // Roughly one triangle per cell, capped so empty space stays cheap.
+        Vec3 ext = max_ - min_;
+        double longest = std::max({ext.x, ext.y, ext.z, 1e-12});
+        int res = std::clamp(static_cast<int>(std::cbrt(static_cast<double>(mesh.indices.size()))) * 2, 1, 64);
+        cell_ = longest / res;
+        for (int k = 0; k < 3; ++k) {
+            double e = k == 0 ? ext.x : (k == 1 ? ext.y : ext.z);
+            dims_[k] = std::max(1, static_cast<int>(std::ceil(e / cell_)));
+        }
+        cells_.assign(static_cast<std::size_t>(dims_[0]) * dims_[1] * dims_[2], {});
+
+        for (std::size_t f = 0; f < mesh.indices.size(); ++f) {
+            const auto& idx = mesh.indices[f];
+            bool valid = true;
+            for (int k = 0; k < 3; ++k) {
+                if (idx[k] < 0 || static_cast<std::size_t>(idx[k]) >= mesh.vertices.size()) valid = false;
+            }
+            if (!valid) continue;
+            const Vec3& a = mesh.vertices[static_cast<std::size_t>(idx[0])];
+            const Vec3& b = mesh.vertices[static_cast<std::size_t>(idx[1])];
+            const Vec3& c = mesh.vertices[static_cast<std::size_t>(idx[2])];
+            std::array<int,3> lo = cellOf(Vec3{std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y}), std::min({a.z, b.z, c.z})});
+            std::array<int,3> hi = cellOf(Vec3{std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y}), std::max({a.z, b.z, c.z})});
+            for (int z = lo[2]; z <= hi[2]; ++z)
+                for (int y = lo[1]; y <= hi[1]; ++y)
+                    for (int x = lo[0]; x <= hi[0]; ++x)
+                        cells_[index(x, y, z)].push_back(static_cast<int>(f));
+        }
+        empty_ = false;
+    }
+
+    double distance(const Vec3& p) const {
+        if (empty_) return 0.0;
+        std::array<int,3> c = cellOf(p);
+        int maxRing = std::max({dims_[0], dims_[1], dims_[2]});
+        double best = std::numeric_limits<double>::infinity();
+        for (int r = 0; r <= maxRing; ++r) {
+            for (int z = c[2] - r; z <= c[2] + r; ++z) {
+                if (z < 0 || z >= dims_[2]) continue;
+                for (int y = c[1] - r; y <= c[1] + r; ++y) {
+                    if (y < 0 || y >= dims_[1]) continue;
+                    for (int x = c[0] - r; x <= c[0] + r; ++x) {
+                        if (x < 0 || x >= dims_[0]) continue;
+                        bool shell = std::abs(x - c[0]) == r || std::abs(y - c[1]) == r || std::abs(z - c[2]) == r;
+                        if (!shell) continue;
+                        for (int f : cells_[index(x, y, z)]) best = std::min(best, distanceToFace(p, f));
+                    }
+                }
+            }
+            // Cells beyond ring r are at least r cells away from the clamped
+            // query point, and clamping onto the grid box never increases
+            // distances to points inside it.
+            if (best <= r * cell_) break;
+        }
+        return best;
+    }
+
+private:
+    std::array<int,3> cellOf(const Vec3& p) const {
+        Vec3 d = p - min_;
+        return {std::clamp(static_cast<int>(std::floor(d.x / cell_)), 0, dims_[0] - 1),
+                std::clamp(static_cast<int>(std::floor(d.y / cell_)), 0, dims_[1] - 1),
+                std::clamp(static_cast<int>(std::floor(d.z / cell_)), 0, dims_[2] - 1)};
+    }
+
+    std::size_t index(int x, int y, int z) const {
+        return (static_cast<std::size_t>(z) * dims_[1] + y) * dims_[0] + x;
+    }
+
+    double distanceToFace(const Vec3& p, int f) const {
+        const auto& idx = mesh_.indices[static_cast<std::size_t>(f)];
+        Vec3 q = closestPointOnTriangle(p,
+                                        mesh_.vertices[static_cast<std::size_t>(idx[0])],
+                                        mesh_.vertices[static_cast<std::size_t>(idx[1])],
+                                        mesh_.vertices[static_cast<std::size_t>(idx[2])]);
+        return (p - q).length();
+    }
+
+    const Mesh& mesh_;
+    Vec3 min_, max_;
+    double cell_ = 1.0;
+    std::array<int,3> dims_{1, 1, 1};
+    std::vector<std::vector<int>> cells_;
+    bool empty_ = true;
+};
+
+// Call fn for points spread over every face of `mesh`: a barycentric lattice
+// with `divisions` steps per edge (vertices, edge points and interior points).
+template <typename Fn>
+void forEachSurfaceSample(const Mesh& mesh, int divisions, Fn&& fn) {
+    for (const auto& idx : mesh.indices) {
+        bool valid = true;
+        for (int k = 0; k < 3; ++k) {
+            if (idx[k] < 0 || static_cast<std::size_t>(idx[k]) >= mesh.vertices.size()) valid = false;
+        }
+        if (!valid) continue;
+        const Vec3& a = mesh.vertices[static_cast<std::size_t>(idx[0])];
+        const Vec3& b = mesh.vertices[static_cast<std::size_t>(idx[1])];
+        const Vec3& c = mesh.vertices[static_cast<std::size_t>(idx[2])];
+        for (int i = 0; i <= divisions; ++i) {
+            for (int j = 0; i + j <= divisions; ++j) {
+                double u = static_cast<double>(i) / divisions;
+                double v = static_cast<double>(j) / divisions;
+                fn(a + (b - a) * u + (c - a) * v);
+            }
+        }
+    }
+}
+
+// Two-sided distance between the original surface and a simplified one,
+// estimated from surface samples. Samples on the coarse faces catch chords
+// that cut inside curved regions; samples on the original catch features
+// the simplification dropped.
+double measureDeviation(const Mesh& original, const SurfaceDistance& originalDistance, const Mesh& simplified) {
+    SurfaceDistance simplifiedDistance(simplified);
+    double worst = 0.0;
+    forEachSurfaceSample(simplified, 4, [&](const Vec3& p) {
+        worst = std::max(worst, originalDistance.distance(p));
+    });
+    forEachSurfaceSample(original, 1, [&](const Vec3& p) {
+        worst = std::max(worst, simplifiedDistance.distance(p));
+    });
+    // Face centroids of the original complete the coarse-side picture.
+    for (const auto& idx : original.indices) {
+        bool valid = true;
+        for (int k = 0; k < 3; ++k) {
+            if (idx[k] < 0 || static_cast<std::size_t>(idx[k]) >= original.vertices.size()) valid = false;
+        }
+        if (!valid) continue;
+        Vec3 centroid = (original.vertices[static_cast<std::size_t>(idx[0])] +
+                         original.vertices[static_cast<std::size_t>(idx[1])] +
+                         original.vertices[static_cast<std::size_t>(idx[2])]) / 3.0;
+        worst = std::max(worst, simplifiedDistance.distance(centroid));
+    }
+    return worst;
+}
+
+struct Outline {
+    double perimeter{};
+    double area{};
+};
+
+// Convex hull of `mesh` projected on the plane orthogonal to `dir`
+// (Andrew's monotone chain).
+Outline projectedHull(const Mesh& mesh, const Vec3& dir) {
+    if (mesh.vertices.size() < 2) return {};
+    Vec3 u = dir.normalized();
+    Vec3 temp{0.0, 1.0, 0.0};
+    if (std::abs(u.y) > 0.999) temp = Vec3{1.0, 0.0, 0.0};
+    Vec3 axisU = temp.cross(u).normalized();
+    Vec3 axisV = u.cross(axisU).normalized();
+
+    std::vector<std::pair<double,double>> pts;
+    pts.reserve(mesh.vertices.size());
+    for (const auto& v : mesh.vertices) pts.emplace_back(v.dot(axisU), v.dot(axisV));
+    std::sort(pts.begin(), pts.end());
+    pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
+    if (pts.size() < 2) return {};
+
+    auto cross = [](const std::pair<double,double>& o, const std::pair<double,double>& a,
+                    const std::pair<double,double>& b) {
+        return (a.first - o.first) * (b.second - o.second) - (a.second - o.second) * (b.first - o.first);
+    };
+    std::vector<std::pair<double,double>> hull(2 * pts.size());
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], pts[i]) <= 0.0) k--;
+        hull[k++] = pts[i];
+    }
+    for (std::size_t i = pts.size() - 1, lower = k + 1; i-- > 0;) {
+        while (k >= lower && cross(hull[k - 2], hull[k - 1], pts[i]) <= 0.0) k--;
+        hull[k++] = pts[i];
+    }
+    Outline outline;
+    for (std::size_t i = 1; i < k; ++i) {
+        outline.perimeter += std::hypot(hull[i].first - hull[i - 1].first, hull[i].second - hull[i - 1].second);
+        outline.area += 0.5 * (hull[i - 1].first * hull[i].second - hull[i].first * hull[i - 1].second);
+    }
+    return outline;
+}
+
+// Outline that contains the projection of anything inside a sphere of
+// diameter `diagonal`, whatever the direction.
+Outline enclosingDisc(double diagonal) {
+    const double kPi = 3.14159265358979323846;
+    return Outline{kPi * diagonal, 0.25 * kPi * diagonal * diagonal};
+}
+
+// Largest area the projection can gain or lose when every point of the
+// silhouette moves by at most `d`: the outline sweeps a band of width d
+// (perimeter * d) plus the rounded corners (pi * d^2).
+double areaErrorBound(double perimeter, double d) {
+    const double kPi = 3.14159265358979323846;
+    return perimeter * d + kPi * d * d;
+}
+
+// Worst-case error of RayTracedShadowSamplerEstimator's samples x samples
+// lattice over a square of side `side`. Every lattice cell the outline
+// crosses can flip (perimeter * cell), and counting samples^2 points for
+// (samples - 1)^2 cells biases the covered area low.
+double gridErrorBound(const Outline& outline, double side, uint32_t samples) {
+    if (samples < 2) return side * side; // a single ray: all or nothing
+    const double n = static_cast<double>(samples);
+    const double cell = side / (n - 1.0);
+    const double coverage = (n - 1.0) / n;
+    return outline.perimeter * cell + outline.area * (1.0 - coverage * coverage);
+}
+
+// Geometric bound of a level plus, when `samples` > 0, the grid error of
+// sampling it. A level with deviation d has an outline and bounding box at
+// most d larger than the original's.
+double levelErrorBound(const Outline& outline, double diagonal, double d, uint32_t samples) {
+    double geometric = areaErrorBound(outline.perimeter, d);
+    if (samples == 0) return geometric;
+    const double kPi = 3.14159265358979323846;
+    Outline grown{outline.perimeter + 2.0 * kPi * d, outline.area + geometric};
+    return geometric + gridErrorBound(grown, diagonal + 2.0 * std::sqrt(3.0) * d, samples);
+}
+
+std::size_t coarsestWithin(const std::vector<MeshLod>& levels, const Outline& outline,
+                           double diagonal, uint32_t samples, double areaTolerance) {
+    for (std::size_t i = levels.size(); i-- > 0;) {
+        if (levelErrorBound(outline, diagonal, levels[i].maxDeviation, samples) <= areaTolerance) return i;
+    }
+    return 0;
+}
+
+} // namespace
+
+MeshLodChain MeshLodChain::build(const Mesh& mesh, const MeshLodOptions& options) {
+    MeshLodChain chain;
+    chain.diagonal_ = computeAabbDiagonal(mesh);
+    chain.levels_.push_back(MeshLod{mesh, 0.0});
+
+    double ratio = std::clamp(options.reductionRatio, 0.0, 1.0);
+    Decimator decimator(mesh);
+    SurfaceDistance originalDistance(mesh);
+    while (chain.levels_.size() < options.maxLevels) {
+        std::size_t current = decimator.aliveFaces();
+        auto target = static_cast<std::size_t>(std::floor(static_cast<double>(current) * ratio));
+        if (target >= current || target < options.minTriangles) break;
+
+        decimator.decimateTo(target);
+        if (decimator.aliveFaces() >= current) break; // no valid collapse left
+
+        Mesh simplified = decimator.snapshot();
+        // Keep deviations non-decreasing so a coarser level never looks better.
+        double deviation = std::max(chain.levels_.back().maxDeviation,
+                                    measureDeviation(mesh, originalDistance, simplified));
+        chain.levels_.push_back(MeshLod{std::move(simplified), deviation});
+        if (decimator.aliveFaces() > target) break; // stalled part-way; nothing coarser possible
+    }
+    return chain;
+}
+
+std::size_t MeshLodChain::selectLevel(const Vec3& windDir, double areaTolerance, uint32_t samples) const {
+    if (levels_.empty()) return 0;
+    return coarsestWithin(levels_, projectedHull(levels_[0].mesh, windDir), diagonal_, samples, areaTolerance);
+}
+
+std::size_t MeshLodChain::selectLevel(double areaTolerance, uint32_t samples) const {
+    if (levels_.empty()) return 0;
+    return coarsestWithin(levels_, enclosingDisc(diagonal_), diagonal_, samples, areaTolerance);
+}
+
+double MeshLodChain::samplingError(const Vec3& windDir, uint32_t samples) const {
+    if (levels_.empty()) return 0.0;
+    return gridErrorBound(projectedHull(levels_[0].mesh, windDir), diagonal_, samples);
+}
+
+double MeshLodChain::samplingError(uint32_t samples) const {
+    if (levels_.empty()) return 0.0;
+    return gridErrorBound(enclosingDisc(diagonal_), diagonal_, samples);
+}
+
+} // namespace rtsa
@@ -0,0 +1,753 @@
+#include "rtsa/shard.hpp"
+#include "rtsa/mesh.hpp"
+#include "rtsa/mesh_lod.hpp"
+#include <iostream>
+
+#ifndef _WIN32
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace rtsa {
+
+#ifdef _WIN32
+
+bool runCoordinator(const CoordinatorConfig& /*config*/, SweepWriter& /*writer*/) {
+    std::cerr << "Sharded sweeps require Unix domain sockets and are not supported on Windows.\n";
+    return false;
+}
+
+bool runWorker(const WorkerConfig& /*config*/, const FrontalAreaEstimator& /*estimator*/) {
+    std::cerr << "Sharded sweeps require Unix domain sockets and are not supported on Windows.\n";
+    return false;
+}
+
+std::string currentExecutablePath(const char* argv0) {
+    return argv0 ? argv0 : "";
+}
+
+#else
+
+namespace {
+
+// A dead peer must not SIGPIPE the process: Linux takes a per-call flag,
+// macOS/BSD a per-socket option (see suppressSigpipe).
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+void suppressSigpipe(int fd) {
+#ifdef SO_NOSIGPIPE
+    int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#else
+    (void)fd;
+#endif
+}
+
+using Clock = std::chrono::steady_clock;
+
+// Wire format: every frame is a 12-byte header (uint32 type, uint64 payload
+// length, native byte order) followed by the payload. Both ends run on the
+// same machine, so no byte swapping is needed.
+enum class MsgType : uint32_t {
+    Request = 1, // worker -> coordinator, empty
+    Unit = 2,    // coordinator -> worker: unit id, mesh index, range, sweep parameters,
+                 //                        area tolerance, heartbeat interval, mesh path
+    Result = 3,  // worker -> coordinator: unit id + SweepBlock columns
+    Done = 4,    // coordinator -> worker, empty
+    Progress = 5 // worker -> coordinator: unit id; still alive and working on it
+};
+
+constexpr std::size_t kHeaderSize = sizeof(uint32_t) + sizeof(uint64_t);
+constexpr uint64_t kMaxPayload = uint64_t{1} << 32;
+
+struct WorkUnit {
+    uint32_t meshIndex;
+    uint64_t begin;
+    uint64_t end;
+};
+
+class PayloadWriter {
+public:
+    template <typename T>
+    void put(const T& value) {
+        bytes_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void putString(const std::string& s) {
+        put<uint64_t>(s.size());
+        bytes_.append(s);
+    }
+    template <typename T>
+    void putColumn(const std::vector<T>& column) {
+        bytes_.append(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+    }
+    const std::string& bytes() const { return bytes_; }
+private:
+    std::string bytes_;
+};
+
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::string& bytes) : data_{bytes.data()}, left_{bytes.size()} {}
+
+    template <typename T>
+    bool get(T& value) {
+        if (left_ < sizeof(T)) return false;
+        std::memcpy(&value, data_, sizeof(T));
+        advance(sizeof(T));
+        return true;
+    }
+    bool getString(std::string& s) {
+        uint64_t n = 0;
+        if (!get(n) || left_ < n) return false;
+        s.assign(data_, static_cast<std::size_t>(n));
+        advance(static_cast<std::size_t>(n));
+        return true;
+    }
+    template <typename T>
+    bool getColumn(std::vector<T>& column, std::size_t rows) {
+        if (rows > left_ / sizeof(T)) return false;
+        column.resize(rows);
+        std::memcpy(column.data(), data_, rows * sizeof(T));
+        advance(rows * sizeof(T));
+        return true;
+    }
+    bool empty() const { return left_ == 0; }
+private:
+    void advance(std::size_t n) { data_ += n; left_ -= n; }
+    const char* data_;
+    std::size_t left_;
+};
+
+void putBlock(PayloadWriter& w, const SweepBlock& block) {
+    w.put<uint64_t>(block.rows());
+    w.putColumn(block.meshIndex);
+    w.putColumn(block.dirIndex);
+    w.putColumn(block.dirX);
+    w.putColumn(block.dirY);
+    w.putColumn(block.dirZ);
+    w.putColumn(block.area);
+    w.putColumn(block.drag);
+}
+
+bool getBlock(PayloadReader& r, SweepBlock& block) {
+    uint64_t rows = 0;
+    if (!r.get(rows)) return false;
+    auto n = static_cast<std::size_t>(rows);
+    return r.getColumn(block.meshIndex, n) && r.getColumn(block.dirIndex, n) &&
+           r.getColumn(block.dirX, n) && r.getColumn(block.dirY, n) &&
+           r.getColumn(block.dirZ, n) && r.getColumn(block.area, n) &&
+           r.getColumn(block.drag, n) && r.empty();
+}
+
+bool sendAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t n = ::send(fd, data, size, kSendFlags);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+bool recvAll(int fd, char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t n = ::recv(fd, data, size, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+bool sendFrame(int fd, MsgType type, const std::string& payload = {}) {
+    char header[kHeaderSize];
+    auto t = static_cast<uint32_t>(type);
+    uint64_t len = payload.size();
+    std::memcpy(header, &t, sizeof(t));
+    std::memcpy(header + sizeof(t), &len, sizeof(len));
+    return sendAll(fd, header, sizeof(header)) && sendAll(fd, payload.data(), payload.size());
+}
+
+bool recvFrame(int fd, MsgType& type, std::string& payload) {
+    char header[kHeaderSize];
+    if (!recvAll(fd, header, sizeof(header))) return false;
+    uint32_t t = 0;
+    uint64_t len = 0;
+    std::memcpy(&t, header, sizeof(t));
+    std::memcpy(&len, header + sizeof(t), sizeof(len));
+    if (len > kMaxPayload) return false;
+    type = static_cast<MsgType>(t);
+    payload.resize(static_cast<std::size_t>(len));
+    return recvAll(fd, payload.data(), payload.size());
+}
+
+// Pop one complete frame off the front of `inbox` if available.
+bool takeFrame(std::string& inbox, MsgType& type, std::string& payload, bool& malformed) {
+    malformed = false;
+    if (inbox.size() < kHeaderSize) return false;
+    uint32_t t = 0;
+    uint64_t len = 0;
+    std::memcpy(&t, inbox.data(), sizeof(t));
+    std::memcpy(&len, inbox.data() + sizeof(t), sizeof(len));
+    if (len > kMaxPayload) {
+        malformed = true;
+        return false;
+    }
+    if (inbox.size() - kHeaderSize < len) return false;
+    type = static_cast<MsgType>(t);
+    payload.assign(inbox, kHeaderSize, static_cast<std::size_t>(len));
+    inbox.erase(0, kHeaderSize + static_cast<std::size_t>(len));
+    return true;
+}
+
+bool makeAddress(const std::string& path, sockaddr_un& addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) return false;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+double secondsSince(Clock::time_point t) {
+    return std::chrono::duration<double>(Clock::now() - t).count();
+}
+
+struct Client {
+    int fd = -1;
+    std::string inbox;
+    int64_t unit = -1;     // unit currently assigned, -1 if none
+    bool waiting = false;  // sent Request while the queue was empty
+    bool dead = false;     // closed; removed at the end of the poll iteration
+    Clock::time_point lastHeard{}; // unit assignment or latest Progress for it
+};
+
+// Make `path` available for bind(). Only a stale socket (nobody accepts on
+// it) is removed; regular files and live coordinators are left alone.
+bool claimSocketPath(const std::string& path, const sockaddr_un& addr) {
+    struct stat st{};
+    if (::lstat(path.c_str(), &st) != 0) {
+        if (errno == ENOENT) return true;
+        std::cerr << "Cannot inspect socket path " << path << ": " << std::strerror(errno) << "\n";
+        return false;
+    }
+    if (!S_ISSOCK(st.st_mode)) {
+        std::cerr << "Socket path " << path << " exists and is not a socket; refusing to replace it\n";
+        return false;
+    }
+    int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) return false;
+    bool live = ::connect(probe, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+    ::close(probe);
+    if (live) {
+        std::cerr << "Another coordinator is listening on " << path << "\n";
+        return false;
+    }
+    return ::unlink(path.c_str()) == 0;
+}
+
+class Coordinator {
+public:
+    Coordinator(const CoordinatorConfig& config, SweepWriter& writer)
+        : config_{config}, writer_{writer} {
+        // Workers may run in another cwd, so hand out absolute paths.
+        for (const auto& path : config.meshPaths) {
+            meshPaths_.push_back(path.empty() ? path : std::filesystem::absolute(path).string());
+        }
+        const uint64_t rows = std::max<uint64_t>(config.unitRows, 1);
+        for (std::size_t m = 0; m < config.meshPaths.size(); ++m) {
+            for (uint64_t b = 0; b < config.sweep.directions; b += rows) {
+                units_.push_back(WorkUnit{static_cast<uint32_t>(m), b,
+                                          std::min(b + rows, config.sweep.directions)});
+            }
+        }
+        attempts_.assign(units_.size(), 0u);
+        done_.assign(units_.size(), false);
+        for (uint64_t u = 0; u < units_.size(); ++u) queue_.push_back(u);
+    }
+
+    ~Coordinator() {
+        for (auto& c : clients_) {
+            if (!c.dead) ::close(c.fd);
+        }
+        if (listenFd_ >= 0) ::close(listenFd_);
+        if (bound_) ::unlink(config_.socketPath.c_str());
+        // Children still running here never got Done (failed run); stop them.
+        for (pid_t pid : children_) ::kill(pid, SIGTERM);
+        while (!children_.empty()) reapChildren(true);
+    }
+
+    bool run() {
+        for (const auto& path : meshPaths_) {
+            if (!path.empty() && !std::ifstream(path)) {
+                std::cerr << "Cannot read mesh " << path << "\n";
+                return false;
+            }
+        }
+
+        sockaddr_un addr{};
+        if (!makeAddress(config_.socketPath, addr)) {
+            std::cerr << "Invalid socket path: " << config_.socketPath << "\n";
+            return false;
+        }
+        if (!claimSocketPath(config_.socketPath, addr)) return false;
+        listenFd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd_ < 0 ||
+            ::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            std::cerr << "Cannot bind " << config_.socketPath << ": " << std::strerror(errno) << "\n";
+            return false;
+        }
+        bound_ = true;
+        if (::listen(listenFd_, 64) != 0) {
+            std::cerr << "Cannot listen on " << config_.socketPath << ": " << std::strerror(errno) << "\n";
+            return false;
+        }
+        if (!spawnWorkers()) return false;
+
+        Clock::time_point lastWorker = Clock::now();
+        while (completed_ < units_.size() && !failed_) {
+            std::vector<pollfd> fds;
+            fds.push_back(pollfd{listenFd_, POLLIN, 0});
+            for (const auto& c : clients_) fds.push_back(pollfd{c.fd, POLLIN, 0});
+            if (::poll(fds.data(), fds.size(), 100) < 0 && errno != EINTR) {
+                std::cerr << "poll failed: " << std::strerror(errno) << "\n";
+                return false;
+            }
+
+            // Indices in `fds` match `clients_`: dropped clients are only
+            // marked dead here and compacted once the iteration is over.
+            for (std::size_t i = 0; i < clients_.size(); ++i) {
+                if (fds[i + 1].revents != 0) service(i);
+            }
+            for (std::size_t i = 0; i < clients_.size(); ++i) {
+                if (!clients_[i].dead && clients_[i].unit >= 0 &&
+                    secondsSince(clients_[i].lastHeard) > config_.unitTimeoutSec) {
+                    std::cerr << "Worker went silent on unit " << clients_[i].unit << "\n";
+                    drop(i);
+                }
+            }
+            for (std::size_t i = 0; i < clients_.size(); ++i) {
+                if (!clients_[i].dead && clients_[i].waiting && !queue_.empty()) assign(i);
+            }
+            clients_.erase(std::remove_if(clients_.begin(), clients_.end(),
+                                          [](const Client& c) { return c.dead; }),
+                           clients_.end());
+            if (fds[0].revents & POLLIN) {
+                int fd = ::accept(listenFd_, nullptr, nullptr);
+                if (fd >= 0) {
+                    suppressSigpipe(fd);
+                    clients_.push_back(Client{fd, {}, -1, false, false, {}});
+                }
+            }
+
+            reapChildren(false);
+            if (!clients_.empty()) {
+                lastWorker = Clock::now();
+            } else if (spawned_ > 0 && children_.empty()) {
+                std::cerr << "All " << spawned_ << " local workers exited; giving up\n";
+                return false;
+            } else if (secondsSince(lastWorker) > config_.idleTimeoutSec) {
+                std::cerr << "No workers connected for " << config_.idleTimeoutSec << " s; giving up\n";
+                return false;
+            }
+        }
+        if (failed_) return false;
+
+        // Answer outstanding and future requests alike; workers treat Done as
+        // the reply to whatever they asked next.
+        for (auto& c : clients_) sendFrame(c.fd, MsgType::Done);
+        drainAfterDone();
+        return true;
+    }
+
+private:
+    // Keep the socket open until local workers have exited and connected ones
+    // have hung up. A worker may get through connect() only now; it must be
+    // told Done rather than left blocking in recv(). Bounded by the idle
+    // timeout; the destructor terminates whatever is left.
+    void drainAfterDone() {
+        Clock::time_point start = Clock::now();
+        while ((!children_.empty() || !clients_.empty()) &&
+               secondsSince(start) <= config_.idleTimeoutSec) {
+            std::vector<pollfd> fds;
+            fds.push_back(pollfd{listenFd_, POLLIN, 0});
+            for (const auto& c : clients_) fds.push_back(pollfd{c.fd, POLLIN, 0});
+            if (::poll(fds.data(), fds.size(), 50) < 0 && errno != EINTR) return;
+
+            for (std::size_t i = 0; i < clients_.size(); ++i) {
+                if (fds[i + 1].revents == 0) continue;
+                char buf[4096];
+                ssize_t n = ::recv(clients_[i].fd, buf, sizeof(buf), MSG_DONTWAIT);
+                if (n > 0 || (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))) {
+                    continue; // Done already answers whatever this was
+                }
+                ::close(clients_[i].fd);
+                clients_[i].dead = true;
+            }
+            clients_.erase(std::remove_if(clients_.begin(), clients_.end(),
+                                          [](const Client& c) { return c.dead; }),
+                           clients_.end());
+            if (fds[0].revents & POLLIN) {
+                int fd = ::accept(listenFd_, nullptr, nullptr);
+                if (fd >= 0) {
+                    suppressSigpipe(fd);
+                    sendFrame(fd, MsgType::Done);
+                    clients_.push_back(Client{fd, {}, -1, false, false, {}});
+                }
+            }
+            reapChildren(false);
+        }
+    }
+
+    // Fork `config_.localWorkers` copies of `config_.workerCommand`. Exec
+    // failures surface as exit status 127 and are reported by reapChildren.
+    bool spawnWorkers() {
+        if (config_.localWorkers == 0) return true;
+        if (config_.workerCommand.empty()) {
+            std::cerr << "localWorkers set without a workerCommand\n";
+            return false;
+        }
+        std::vector<char*> argv;
+        for (const auto& arg : config_.workerCommand) argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+
+        for (unsigned w = 0; w < config_.localWorkers; ++w) {
+            pid_t pid = ::fork();
+            if (pid == 0) {
+                ::execvp(argv[0], argv.data());
+                // No iostreams between fork and _exit.
+                const char* reason = std::strerror(errno);
+                for (const char* part : {"Cannot start worker ", static_cast<const char*>(argv[0]),
+                                         ": ", reason, "\n"}) {
+                    ssize_t ignored = ::write(STDERR_FILENO, part, std::strlen(part));
+                    (void)ignored;
+                }
+                ::_exit(127);
+            }
+            if (pid < 0) {
+                std::cerr << "fork failed for worker " << w << ": " << std::strerror(errno) << "\n";
+                continue;
+            }
+            children_.push_back(pid);
+            spawned_++;
+        }
+        if (spawned_ == 0) {
+            std::cerr << "No local workers could be started\n";
+            return false;
+        }
+        return true;
+    }
+
+    void reapChildren(bool block) {
+        for (std::size_t i = children_.size(); i-- > 0;) {
+            int status = 0;
+            pid_t r = ::waitpid(children_[i], &status, block ? 0 : WNOHANG);
+            if (r == 0) continue;
+            if (r > 0 && !(WIFEXITED(status) && WEXITSTATUS(status) == 0) && !block) {
+                std::cerr << "Worker process " << children_[i] << " exited with status "
+                          << (WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status)) << "\n";
+            }
+            children_.erase(children_.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+
+    void service(std::size_t i) {
+        char buf[65536];
+        for (;;) {
+            ssize_t n = ::recv(clients_[i].fd, buf, sizeof(buf), MSG_DONTWAIT);
+            if (n > 0) {
+                clients_[i].inbox.append(buf, static_cast<std::size_t>(n));
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            // Orderly shutdown or hard error: the worker is gone. Frames that
+            // arrived before the close are still processed below.
+            handleFrames(i);
+            if (!clients_[i].dead) drop(i);
+            return;
+        }
+        handleFrames(i);
+    }
+
+    void handleFrames(std::size_t i) {
+        MsgType type{};
+        std::string payload;
+        bool malformed = false;
+        while (!clients_[i].dead && takeFrame(clients_[i].inbox, type, payload, malformed)) {
+            if (type == MsgType::Request && clients_[i].unit < 0) {
+                if (!queue_.empty()) assign(i);
+                else if (completed_ == units_.size()) sendFrame(clients_[i].fd, MsgType::Done);
+                else clients_[i].waiting = true; // others still hold units that may be retried
+            } else if (type == MsgType::Progress) {
+                PayloadReader r(payload);
+                uint64_t unitId = 0;
+                if (r.get(unitId) && clients_[i].unit >= 0 &&
+                    unitId == static_cast<uint64_t>(clients_[i].unit)) {
+                    clients_[i].lastHeard = Clock::now();
+                }
+            } else if (type == MsgType::Result) {
+                if (!acceptResult(i, payload)) {
+                    std::cerr << "Malformed result from worker; dropping it\n";
+                    drop(i);
+                    return;
+                }
+            } else {
+                malformed = true;
+                break;
+            }
+        }
+        if (malformed && !clients_[i].dead) {
+            std::cerr << "Protocol error from worker; dropping it\n";
+            drop(i);
+        }
+    }
+
+    bool acceptResult(std::size_t i, const std::string& payload) {
+        PayloadReader r(payload);
+        uint64_t unitId = 0;
+        SweepBlock block;
+        if (!r.get(unitId) || !getBlock(r, block)) return false;
+        if (clients_[i].unit < 0 || unitId != static_cast<uint64_t>(clients_[i].unit)) return false;
+
+        const WorkUnit& u = units_[unitId];
+        if (block.rows() != u.end - u.begin) return false;
+        for (std::size_t k = 0; k < block.rows(); ++k) {
+            if (block.meshIndex[k] != u.meshIndex || block.dirIndex[k] != u.begin + k) return false;
+        }
+
+        clients_[i].unit = -1;
+        done_[unitId] = true;
+        completed_++;
+        writer_.submit(unitId, std::move(block));
+        return true;
+    }
+
+    void assign(std::size_t i) {
+        uint64_t unitId = queue_.front();
+        queue_.pop_front();
+        attempts_[unitId]++;
+
+        const WorkUnit& u = units_[unitId];
+        PayloadWriter w;
+        w.put(unitId);
+        w.put(u.meshIndex);
+        w.put(u.begin);
+        w.put(u.end);
+        w.put(config_.sweep.directions);
+        w.put(config_.sweep.samples);
+        w.put(config_.sweep.rho);
+        w.put(config_.sweep.Cd);
+        w.put(config_.sweep.speed);
+        w.put(config_.areaTol);
+        w.put(heartbeatSec());
+        w.putString(meshPaths_[u.meshIndex]);
+
+        clients_[i].unit = static_cast<int64_t>(unitId);
+        clients_[i].waiting = false;
+        clients_[i].lastHeard = Clock::now();
+        if (!sendFrame(clients_[i].fd, MsgType::Unit, w.bytes())) drop(i);
+    }
+
+    // Several heartbeats fit in one timeout, so a single late one is harmless.
+    double heartbeatSec() const { return config_.unitTimeoutSec / 4.0; }
+
+    // Close a worker connection and put its unfinished unit back at the front
+    // of the queue so the merge order is not held up for long.
+    void drop(std::size_t i) {
+        int64_t unit = clients_[i].unit;
+        ::close(clients_[i].fd);
+        clients_[i].dead = true;
+        clients_[i].unit = -1;
+        if (unit < 0 || done_[static_cast<std::size_t>(unit)]) return;
+
+        auto u = static_cast<std::size_t>(unit);
+        if (attempts_[u] >= config_.maxAttempts) {
+            std::cerr << "Unit " << unit << " failed " << attempts_[u] << " times; giving up\n";
+            failed_ = true;
+            return;
+        }
+        std::cerr << "Retrying unit " << unit << " (attempt " << attempts_[u] + 1 << ")\n";
+        queue_.push_front(u);
+    }
+
+    const CoordinatorConfig& config_;
+    SweepWriter& writer_;
+    std::vector<std::string> meshPaths_;
+    int listenFd_ = -1;
+    bool bound_ = false;          // the socket file is ours to unlink
+    std::vector<pid_t> children_; // local workers not yet reaped
+    unsigned spawned_ = 0;
+    std::vector<WorkUnit> units_;
+    std::vector<unsigned> attempts_;
+    std::vector<bool> done_;
+    std::deque<uint64_t> queue_;
+    std::size_t completed_ = 0;
+    bool failed_ = false;
+    std::vector<Client> clients_;
+};
+
+int connectWithRetry(const WorkerConfig& config) {
+    sockaddr_un addr{};
+    if (!makeAddress(config.socketPath, addr)) return -1;
+    Clock::time_point start = Clock::now();
+    for (;;) {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+            suppressSigpipe(fd);
+            return fd;
+        }
+        ::close(fd);
+        if (secondsSince(start) > config.connectTimeoutSec) return -1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+}
+
+// Sends Progress for `unitId` every `interval` seconds until stopped, so a
+// unit that takes longer than the coordinator's timeout is not mistaken for
+// a dead worker. Owns the socket's send side while it runs.
+class Heartbeat {
+public:
+    Heartbeat(int fd, uint64_t unitId, double interval)
+        : thread_([this, fd, unitId, interval]() {
+              PayloadWriter w;
+              w.put(unitId);
+              auto period = std::chrono::duration<double>(std::max(interval, 0.01));
+              std::unique_lock<std::mutex> lock(mutex_);
+              while (!cv_.wait_for(lock, period, [this]() { return stop_; })) {
+                  if (!sendFrame(fd, MsgType::Progress, w.bytes())) return;
+              }
+          }) {}
+
+    ~Heartbeat() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+    Heartbeat(const Heartbeat&) = delete;
+    Heartbeat& operator=(const Heartbeat&) = delete;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread thread_; // last: starts after the members it uses
+};
+
+} // namespace
+
+bool runCoordinator(const CoordinatorConfig& config, SweepWriter& writer) {
+    Coordinator coordinator(config, writer);
+    return coordinator.run();
+}
+
+bool runWorker(const WorkerConfig& config, const FrontalAreaEstimator& estimator) {
+    int fd = connectWithRetry(config);
+    if (fd < 0) {
+        std::cerr << "Cannot connect to coordinator at " << config.socketPath << "\n";
+        return false;
+    }
+
+    // Meshes are cached by path; units arrive mesh-major so reloads are rare.
+    std::string loadedPath;
+    Mesh mesh;
+    MeshLodChain lods;
+    const Mesh* evalMesh = nullptr;
+    bool ok = false;
+
+    MsgType type{};
+    std::string payload;
+    while (sendFrame(fd, MsgType::Request) && recvFrame(fd, type, payload)) {
+        if (type == MsgType::Done) {
+            ok = true;
+            break;
+        }
+        if (type != MsgType::Unit) break;
+
+        PayloadReader r(payload);
+        uint64_t unitId = 0;
+        uint32_t meshIndex = 0;
+        uint64_t begin = 0, end = 0;
+        SweepConfig sweep;
+        double areaTol = 0.0;
+        double heartbeatSec = 0.0;
+        std::string meshPath;
+        if (!r.get(unitId) || !r.get(meshIndex) || !r.get(begin) || !r.get(end) ||
+            !r.get(sweep.directions) || !r.get(sweep.samples) || !r.get(sweep.rho) ||
+            !r.get(sweep.Cd) || !r.get(sweep.speed) || !r.get(areaTol) ||
+            !r.get(heartbeatSec) || !r.getString(meshPath)) {
+            break;
+        }
+
+        if (!evalMesh || meshPath != loadedPath) {
+            if (meshPath.empty()) {
+                mesh = Mesh::unitCube();
+            } else if (!Mesh::loadObj(meshPath, mesh)) {
+                std::cerr << "Worker cannot load mesh " << meshPath << "\n";
+                break;
+            }
+            loadedPath = meshPath;
+            evalMesh = &mesh;
+            // Same direction-free LOD choice as a single-process --sweep.
+            if (areaTol > 0.0) {
+                lods = MeshLodChain::build(mesh);
+                evalMesh = &lods.level(lods.selectLevel(areaTol, sweep.samples)).mesh;
+            }
+        }
+
+        SweepBlock block;
+        {
+            Heartbeat heartbeat(fd, unitId, heartbeatSec);
+            block = evaluateDirections(estimator, *evalMesh, meshIndex, begin, end, sweep);
+        }
+        PayloadWriter w;
+        w.put(unitId);
+        putBlock(w, block);
+        if (!sendFrame(fd, MsgType::Result, w.bytes())) break;
+    }
+    ::close(fd);
+    return ok;
+}
+
+std::string currentExecutablePath(const char* argv0) {
+#ifdef __linux__
+    char buf[PATH_MAX];
+    ssize_t n = ::readlink("/proc/self/exe", buf, sizeof(buf) - 1);
+    if (n > 0) return std::string(buf, static_cast<std::size_t>(n));
+#endif
+    // execvp() resolves a bare name through PATH, matching how the shell
+    // found us; anything with a slash is made absolute against the cwd.
+    std::string path = argv0 ? argv0 : "";
+    if (path.find('/') != std::string::npos) path = std::filesystem::absolute(path).string();
+    return path;
+}
+
+#endif
+
+} // namespace rtsa
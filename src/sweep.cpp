@@ -0,0 +1,83 @@
+#include "rtsa/sweep.hpp"
+#include "rtsa/aerodynamics.hpp"
+#include "rtsa/sweep_writer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace rtsa {
+
+Vec3 sphereDirection(uint64_t index, uint64_t count) {
+    if (count <= 1) return Vec3{1.0, 0.0, 0.0};
+    // Golden-angle spiral: z steps uniformly from 1 to -1, longitude advances
+    // by the golden angle so neighbouring rows never line up.
+    const double kGoldenAngle = 2.39996322972865332;
+    double z = 1.0 - 2.0 * (static_cast<double>(index) + 0.5) / static_cast<double>(count);
+    double r = std::sqrt(std::max(0.0, 1.0 - z * z));
+    double phi = kGoldenAngle * static_cast<double>(index);
+    return Vec3{r * std::cos(phi), r * std::sin(phi), z};
+}
+
+void SweepBlock::reserve(std::size_t n) {
+    meshIndex.reserve(n);
+    dirIndex.reserve(n);
+    dirX.reserve(n);
+    dirY.reserve(n);
+    dirZ.reserve(n);
+    area.reserve(n);
+    drag.reserve(n);
+}
+
+SweepBlock evaluateDirections(const FrontalAreaEstimator& estimator,
+                              const Mesh& mesh,
+                              uint32_t meshIndex,
+                              uint64_t begin,
+                              uint64_t end,
+                              const SweepConfig& config) {
+    SweepBlock block;
+    end = std::min(end, config.directions);
+    if (begin >= end) return block;
+    block.reserve(static_cast<std::size_t>(end - begin));
+    for (uint64_t d = begin; d < end; ++d) {
+        Vec3 dir = sphereDirection(d, config.directions);
+        double area = estimator.estimateFrontalArea(mesh, dir, config.samples);
+        block.meshIndex.push_back(meshIndex);
+        block.dirIndex.push_back(d);
+        block.dirX.push_back(dir.x);
+        block.dirY.push_back(dir.y);
+        block.dirZ.push_back(dir.z);
+        block.area.push_back(area);
+        block.drag.push_back(computeDragMagnitude(config.rho, config.Cd, config.speed, area));
+    }
+    return block;
+}
+
+void runSweep(const FrontalAreaEstimator& estimator,
+              const Mesh& mesh,
+              uint32_t meshIndex,
+              const SweepConfig& config,
+              SweepWriter& writer) {
+    const uint64_t blockRows = std::max<uint64_t>(config.blockRows, 1);
+    const uint64_t blocks = (config.directions + blockRows - 1) / blockRows;
+    unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::clamp<uint64_t>(threads, 1, std::max<uint64_t>(blocks, 1)));
+
+    // Blocks are claimed dynamically so uneven per-direction cost balances out.
+    std::atomic<uint64_t> nextBlock{0};
+    auto work = [&]() {
+        for (uint64_t b = nextBlock++; b < blocks; b = nextBlock++) {
+            uint64_t begin = b * blockRows;
+            writer.submit(b, evaluateDirections(estimator, mesh, meshIndex,
+                                                begin, begin + blockRows, config));
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (auto& t : pool) t.join();
+}
+
+} // namespace rtsa
@@ -0,0 +1,210 @@
+#include "rtsa/sweep_writer.hpp"
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace rtsa {
+
+namespace {
+
+// Columns are dumped straight from memory; the format is defined as little-endian.
+static_assert(std::endian::native == std::endian::little,
+              "sweep files are little-endian; add byte swapping for this host");
+
+template <typename T>
+void writeColumn(std::ofstream& out, const std::vector<T>& column) {
+    out.write(reinterpret_cast<const char*>(column.data()),
+              static_cast<std::streamsize>(column.size() * sizeof(T)));
+}
+
+template <typename T>
+bool readColumn(std::istream& in, std::vector<T>& column, std::size_t rows) {
+    column.resize(rows);
+    in.read(reinterpret_cast<char*>(column.data()),
+            static_cast<std::streamsize>(rows * sizeof(T)));
+    return static_cast<bool>(in);
+}
+
+template <typename T>
+void appendNumber(std::string& line, T value) {
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    line.append(buf, res.ptr);
+}
+
+} // namespace
+
+SweepWriter::SweepWriter(const std::string& path)
+    : out_{path, std::ios::binary | std::ios::trunc} {
+    if (!out_) {
+        failed_ = true;
+        return;
+    }
+    out_.write(kSweepMagic, sizeof(kSweepMagic));
+    out_.write(reinterpret_cast<const char*>(&kSweepVersion), sizeof(kSweepVersion));
+    thread_ = std::thread([this]() { run(); });
+}
+
+SweepWriter::~SweepWriter() {
+    abandon();
+}
+
+bool SweepWriter::ok() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !failed_;
+}
+
+uint64_t SweepWriter::rowsWritten() const {
+    return rows_.load();
+}
+
+void SweepWriter::submit(uint64_t sequence, SweepBlock block) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.emplace_back(sequence, std::move(block));
+    }
+    cv_.notify_one();
+}
+
+bool SweepWriter::finish() {
+    return close(true);
+}
+
+void SweepWriter::abandon() {
+    close(false);
+}
+
+bool SweepWriter::close(bool commit) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (finished_) return !failed_;
+        finished_ = true;
+        closing_ = true;
+        if (!commit) {
+            failed_ = true;
+            queue_.clear(); // nothing left for the writer thread to do
+        }
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) return false;
+    if (!pending_.empty()) failed_ = true; // a sequence number never arrived
+    if (!failed_) {
+        const uint64_t endMarker = 0;
+        out_.write(reinterpret_cast<const char*>(&endMarker), sizeof(endMarker));
+    }
+    out_.close();
+    if (!out_) failed_ = true;
+    return !failed_;
+}
+
+void SweepWriter::run() {
+    std::deque<std::pair<uint64_t, SweepBlock>> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return closing_ || !queue_.empty(); });
+            if (queue_.empty() && closing_) return;
+            batch.swap(queue_);
+        }
+
+        // File I/O happens outside the lock so submit() stays cheap.
+        for (auto& [sequence, block] : batch) pending_.emplace(sequence, std::move(block));
+        batch.clear();
+        for (auto it = pending_.find(nextSequence_); it != pending_.end();
+             it = pending_.find(nextSequence_)) {
+            writeBlock(it->second);
+            pending_.erase(it);
+            nextSequence_++;
+        }
+        if (!out_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed_ = true;
+        }
+    }
+}
+
+void SweepWriter::writeBlock(const SweepBlock& block) {
+    const uint64_t rows = block.rows();
+    if (rows == 0) return; // a zero row count is the end marker
+    out_.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    writeColumn(out_, block.meshIndex);
+    writeColumn(out_, block.dirIndex);
+    writeColumn(out_, block.dirX);
+    writeColumn(out_, block.dirY);
+    writeColumn(out_, block.dirZ);
+    writeColumn(out_, block.area);
+    writeColumn(out_, block.drag);
+    rows_ += rows;
+}
+
+bool readSweepFile(const std::string& path,
+                   const std::function<void(const SweepBlock&)>& onBlock) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    const auto fileSize = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+
+    char magic[sizeof(kSweepMagic)];
+    uint32_t version = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || std::memcmp(magic, kSweepMagic, sizeof(magic)) != 0 || version != kSweepVersion) {
+        return false;
+    }
+
+    SweepBlock block;
+    for (;;) {
+        uint64_t rows = 0;
+        in.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+        if (!in) return false;
+        if (rows == 0) return true;
+        // Check the count against what is left before allocating for it.
+        const auto remaining = fileSize - static_cast<uint64_t>(in.tellg());
+        if (rows > remaining / kSweepRowBytes) return false;
+        auto n = static_cast<std::size_t>(rows);
+        if (!readColumn(in, block.meshIndex, n) || !readColumn(in, block.dirIndex, n) ||
+            !readColumn(in, block.dirX, n) || !readColumn(in, block.dirY, n) ||
+            !readColumn(in, block.dirZ, n) || !readColumn(in, block.area, n) ||
+            !readColumn(in, block.drag, n)) {
+            return false;
+        }
+        onBlock(block);
+    }
+}
+
+bool convertSweepToCsv(const std::string& binPath, const std::string& csvPath) {
+    std::ofstream out(csvPath, std::ios::trunc);
+    if (!out) return false;
+    out << "mesh,dir_index,dir_x,dir_y,dir_z,area_est,drag_mag\n";
+
+    // std::to_chars gives shortest round-trip output without iostream overhead.
+    std::string buffer;
+    bool ok = readSweepFile(binPath, [&](const SweepBlock& block) {
+        buffer.clear();
+        for (std::size_t i = 0; i < block.rows(); ++i) {
+            appendNumber(buffer, block.meshIndex[i]); buffer += ',';
+            appendNumber(buffer, block.dirIndex[i]);  buffer += ',';
+            appendNumber(buffer, block.dirX[i]);      buffer += ',';
+            appendNumber(buffer, block.dirY[i]);      buffer += ',';
+            appendNumber(buffer, block.dirZ[i]);      buffer += ',';
+            appendNumber(buffer, block.area[i]);      buffer += ',';
+            appendNumber(buffer, block.drag[i]);      buffer += '\n';
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    });
+    out.close();
+    if (!ok || !out) {
+        // Never leave a clean-looking CSV behind for a truncated sweep.
+        std::error_code ec;
+        std::filesystem::remove(csvPath, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace rtsa
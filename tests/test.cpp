@@ -1,18 +1,41 @@
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "rtsa/mesh.hpp"
+#include "rtsa/mesh_lod.hpp"
 #include "rtsa/mesh_object.hpp"
 #include "rtsa/physics_object.hpp"
 #include "rtsa/raytraced_shadow_sampler_estimator.hpp"
+#include "rtsa/shard.hpp"
+#include "rtsa/sweep.hpp"
+#include "rtsa/sweep_writer.hpp"
 #include "rtsa/vec3.hpp"
 
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using rtsa::FrontalAreaEstimator;
 using rtsa::Mesh;
+using rtsa::MeshLodChain;
 using rtsa::MeshObject;
 using rtsa::PhysicsObject;
 using rtsa::RayTracedShadowSamplerEstimator;
+using rtsa::SweepBlock;
+using rtsa::SweepConfig;
+using rtsa::SweepWriter;
 using rtsa::Vec3;
 
 namespace {
@@ -60,6 +83,15 @@ void expectEqual(TestStats& stats,
     }
 }
 
+void expectTrue(TestStats& stats, bool condition, const std::string& name) {
+    if (condition) {
+        stats.passed++;
+    } else {
+        stats.failed++;
+        reportFailure(name, "condition is false");
+    }
+}
+
 Mesh makeTriangleMesh() {
     Mesh m;
     m.vertices = {
@@ -89,6 +121,56 @@ Mesh makeSquarePlate(double side) {
     return m;
 }
 
+// Flat square plate in the YZ plane split into `n` x `n` quads.
+Mesh makeGridPlate(double side, int n) {
+    Mesh m;
+    const double h = 0.5 * side;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            m.vertices.push_back({0.0, -h + side * i / n, -h + side * j / n});
+        }
+    }
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            int v0 = j * (n + 1) + i;
+            int v1 = v0 + 1;
+            int v2 = v0 + (n + 1) + 1;
+            int v3 = v0 + (n + 1);
+            m.indices.push_back({v0, v1, v2});
+            m.indices.push_back({v0, v2, v3});
+        }
+    }
+    return m;
+}
+
+// Closed UV sphere centered at origin.
+Mesh makeUvSphere(double radius, int rings, int segments) {
+    const double kPi = 3.14159265358979323846;
+    Mesh m;
+    m.vertices.push_back({0.0, 0.0, radius});
+    for (int r = 1; r < rings; ++r) {
+        double theta = kPi * r / rings;
+        for (int s = 0; s < segments; ++s) {
+            double phi = 2.0 * kPi * s / segments;
+            m.vertices.push_back({radius * std::sin(theta) * std::cos(phi),
+                                  radius * std::sin(theta) * std::sin(phi),
+                                  radius * std::cos(theta)});
+        }
+    }
+    m.vertices.push_back({0.0, 0.0, -radius});
+    const int south = static_cast<int>(m.vertices.size()) - 1;
+    auto ring = [segments](int r, int s) { return 1 + (r - 1) * segments + (s % segments); };
+    for (int s = 0; s < segments; ++s) {
+        m.indices.push_back({0, ring(1, s), ring(1, s + 1)});
+        for (int r = 1; r < rings - 1; ++r) {
+            m.indices.push_back({ring(r, s), ring(r + 1, s), ring(r + 1, s + 1)});
+            m.indices.push_back({ring(r, s), ring(r + 1, s + 1), ring(r, s + 1)});
+        }
+        m.indices.push_back({south, ring(rings - 1, s + 1), ring(rings - 1, s)});
+    }
+    return m;
+}
+
 Mesh translateMesh(const Mesh& base, const Vec3& delta) {
     Mesh m = base;
     for (auto& v : m.vertices) {
@@ -107,11 +189,81 @@ private:
     Mesh mesh_;
 };
 
+#ifndef _WIN32
+// Speak just enough of the shard protocol to be handed a unit, then hang up
+// without answering. Returns true once a Unit frame header was received.
+bool grabUnitAndHangUp(const std::string& socketPath) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return false;
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            ::close(fd);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+        char header[12] = {};
+        const uint32_t request = 1;
+        std::memcpy(header, &request, sizeof(request));
+        bool ok = ::send(fd, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                  ::recv(fd, header, sizeof(header), MSG_WAITALL) == static_cast<ssize_t>(sizeof(header));
+        uint32_t type = 0;
+        std::memcpy(&type, header, sizeof(type));
+        ::close(fd);
+        return ok && type == 2;
+    }
+    return false;
+}
+
+// Delegates to another estimator after a fixed delay per direction.
+class SlowEstimator : public FrontalAreaEstimator {
+public:
+    SlowEstimator(const FrontalAreaEstimator& inner, std::chrono::milliseconds delay)
+        : inner_{inner}, delay_{delay} {}
+    double estimateFrontalArea(const Mesh& mesh, const Vec3& windDir, uint32_t samples) const override {
+        std::this_thread::sleep_for(delay_);
+        return inner_.estimateFrontalArea(mesh, windDir, samples);
+    }
+private:
+    const FrontalAreaEstimator& inner_;
+    std::chrono::milliseconds delay_;
+};
+
+// Rows of a sharded unit-cube sweep must equal a serial evaluation, in order.
+bool shardOutputMatches(const FrontalAreaEstimator& estimator,
+                        const std::string& binPath,
+                        const SweepConfig& sweep,
+                        uint64_t meshes) {
+    Mesh cube = Mesh::unitCube();
+    SweepBlock reference = rtsa::evaluateDirections(estimator, cube, 0, 0, sweep.directions, sweep);
+    uint64_t row = 0;
+    bool merged = true;
+    bool read = rtsa::readSweepFile(binPath, [&](const SweepBlock& block) {
+        for (std::size_t i = 0; i < block.rows(); ++i, ++row) {
+            uint64_t d = row % sweep.directions;
+            merged = merged && block.meshIndex[i] == row / sweep.directions &&
+                     block.dirIndex[i] == d && block.area[i] == reference.area[d];
+        }
+    });
+    return read && merged && row == meshes * sweep.directions;
+}
+#endif
+
 } // namespace
 
-int main() {
+int main(int argc, char** argv) {
     TestStats stats{};
     RayTracedShadowSamplerEstimator estimator;
+#ifndef _WIN32
+    // The worker-process test re-executes this binary as a shard worker.
+    if (argc == 4 && std::string(argv[1]) == "--worker" && std::string(argv[2]) == "--socket") {
+        rtsa::WorkerConfig config;
+        config.socketPath = argv[3];
+        return rtsa::runWorker(config, estimator) ? 0 : 1;
+    }
+#endif
     const Vec3 wind{1.0, 0.0, 0.0};
     const uint32_t samples = 1024;
 
@@ -150,6 +302,427 @@ int main() {
         expectEqual(stats, area, 0.0, "empty mesh frontal area");
     }
 
+    {
+        // Interior collapses on a flat plate are free; boundary planes keep the outline.
+        auto lods = MeshLodChain::build(makeGridPlate(2.0, 16));
+        expectTrue(stats, lods.levelCount() > 2, "grid plate LOD chain has levels");
+        bool shrinking = true;
+        double worstDeviation = 0.0;
+        for (std::size_t i = 1; i < lods.levelCount(); ++i) {
+            shrinking = shrinking && lods.level(i).mesh.indices.size() < lods.level(i - 1).mesh.indices.size();
+            worstDeviation = std::max(worstDeviation, lods.level(i).maxDeviation);
+        }
+        expectTrue(stats, shrinking, "grid plate LOD triangle counts decrease");
+        expectNear(stats, worstDeviation, 0.0, 1e-9, "grid plate LOD deviation stays zero");
+        const auto& coarsest = lods.level(lods.levelCount() - 1).mesh;
+        double area = estimator.estimateFrontalArea(coarsest, wind, samples);
+        expectNear(stats, area, 4.0, 0.2, "coarsest grid plate LOD frontal area along +X");
+    }
+
+    {
+        const double kPi = 3.14159265358979323846;
+        const uint32_t sphereSamples = 128;
+        Mesh sphere = makeUvSphere(1.0, 16, 32);
+        auto lods = MeshLodChain::build(sphere);
+        bool monotone = lods.level(0).maxDeviation == 0.0;
+        for (std::size_t i = 1; i < lods.levelCount(); ++i) {
+            monotone = monotone && lods.level(i).maxDeviation >= lods.level(i - 1).maxDeviation;
+        }
+        expectTrue(stats, monotone, "sphere LOD deviations are non-decreasing");
+        expectEqual(stats, static_cast<double>(lods.selectLevel(wind, 1e9)),
+                    static_cast<double>(lods.levelCount() - 1), "huge tolerance selects coarsest LOD");
+        expectEqual(stats, static_cast<double>(lods.selectLevel(wind, 1e-6)), 0.0,
+                    "tiny tolerance selects full-resolution LOD");
+
+        double full = estimator.estimateFrontalArea(sphere, wind, sphereSamples);
+        expectNear(stats, full, kPi, 0.1, "sphere frontal area along +X");
+
+        // The bound behind selectLevel must cover the measured error of every level.
+        const double perimeter = 2.0 * kPi; // projected outline of the unit sphere
+        bool bounded = true;
+        for (std::size_t i = 1; i < lods.levelCount(); ++i) {
+            double d = lods.level(i).maxDeviation;
+            double area = estimator.estimateFrontalArea(lods.level(i).mesh, wind, sphereSamples);
+            bounded = bounded && std::abs(area - full) <= perimeter * d + kPi * d * d;
+        }
+        expectTrue(stats, bounded, "sphere LOD area error stays within its bound");
+
+        const double tolerance = 0.3;
+        std::size_t level = lods.selectLevel(wind, tolerance, sphereSamples);
+        expectTrue(stats, level > 0, "moderate tolerance selects a coarser sphere LOD");
+        double coarse = estimator.estimateFrontalArea(lods, wind, sphereSamples, tolerance);
+        expectNear(stats, coarse, kPi, tolerance, "sphere LOD plus grid error within tolerance");
+
+        // A coarser grid leaves less of the budget to simplification.
+        expectTrue(stats, lods.selectLevel(wind, tolerance, 1024) > level,
+                   "finer sampling grid allows a coarser sphere LOD");
+        expectTrue(stats, lods.samplingError(wind, 16) > tolerance &&
+                          lods.selectLevel(wind, tolerance, 16) == 0,
+                   "grid error beyond tolerance keeps full resolution");
+    }
+
+    {
+        auto cube = Mesh::unitCube();
+        double area = estimator.estimateFrontalArea(cube, Vec3{1.0, 1.0, 1.0}.normalized(), samples);
+        expectNear(stats, area, std::sqrt(3.0), 0.1, "unit cube frontal area along body diagonal");
+    }
+
+    {
+        const uint64_t count = 500;
+        double worst = 0.0;
+        Vec3 mean{0.0, 0.0, 0.0};
+        for (uint64_t i = 0; i < count; ++i) {
+            Vec3 d = rtsa::sphereDirection(i, count);
+            worst = std::max(worst, std::abs(d.length() - 1.0));
+            mean = mean + d;
+        }
+        expectNear(stats, worst, 0.0, 1e-12, "sweep directions are unit length");
+        expectNear(stats, (mean / static_cast<double>(count)).length(), 0.0, 0.01,
+                   "sweep directions cover the sphere evenly");
+    }
+
+    {
+        SweepConfig config;
+        config.directions = 203;
+        config.samples = 48;
+        config.speed = 10.0;
+        config.threads = 4;
+        config.blockRows = 16;
+
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string binPath = (dir / "rtsa_test_sweep.bin").string();
+        const std::string csvPath = (dir / "rtsa_test_sweep.csv").string();
+
+        Mesh cube = Mesh::unitCube();
+        SweepWriter writer(binPath);
+        rtsa::runSweep(estimator, cube, 7, config, writer);
+        expectTrue(stats, writer.finish(), "sweep writer finishes cleanly");
+        expectEqual(stats, static_cast<double>(writer.rowsWritten()), 203.0, "sweep writer row count");
+
+        SweepBlock reference = rtsa::evaluateDirections(estimator, cube, 7, 0, config.directions, config);
+        uint64_t row = 0;
+        bool ordered = true;
+        bool matches = true;
+        bool readOk = rtsa::readSweepFile(binPath, [&](const SweepBlock& block) {
+            for (std::size_t i = 0; i < block.rows(); ++i, ++row) {
+                ordered = ordered && block.dirIndex[i] == row && block.meshIndex[i] == 7;
+                matches = matches && row < reference.rows() &&
+                          block.area[i] == reference.area[row] &&
+                          block.drag[i] == reference.drag[row];
+            }
+        });
+        expectTrue(stats, readOk, "sweep file reads back");
+        expectTrue(stats, ordered && row == 203, "sweep rows are in direction order");
+        expectTrue(stats, matches, "parallel sweep matches serial evaluation");
+
+        expectTrue(stats, rtsa::convertSweepToCsv(binPath, csvPath), "sweep converts to CSV");
+        std::ifstream csv(csvPath);
+        std::string line;
+        int lines = 0;
+        while (std::getline(csv, line)) lines++;
+        expectEqual(stats, lines, 204.0, "sweep CSV has header plus one line per row");
+
+        std::filesystem::remove(binPath);
+        std::filesystem::remove(csvPath);
+    }
+
+    {
+        // A missing block must leave a file that reads back as truncated.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string binPath = (dir / "rtsa_test_sweep_gap.bin").string();
+        const std::string csvPath = (dir / "rtsa_test_sweep_gap.csv").string();
+        SweepConfig config;
+        config.directions = 8;
+        config.samples = 8;
+        Mesh cube = Mesh::unitCube();
+        {
+            SweepWriter writer(binPath);
+            writer.submit(0, rtsa::evaluateDirections(estimator, cube, 0, 0, 4, config));
+            writer.submit(2, rtsa::evaluateDirections(estimator, cube, 0, 4, 8, config));
+            expectTrue(stats, !writer.finish(), "sweep writer reports a missing block");
+        }
+        expectTrue(stats, !rtsa::readSweepFile(binPath, [](const SweepBlock&) {}),
+                   "sweep file with a missing block reads as truncated");
+        expectTrue(stats, !rtsa::convertSweepToCsv(binPath, csvPath) && !std::filesystem::exists(csvPath),
+                   "truncated sweep file is not converted to CSV");
+
+        // Contiguous blocks are still not committed unless finish() is called.
+        {
+            SweepWriter writer(binPath);
+            writer.submit(0, rtsa::evaluateDirections(estimator, cube, 0, 0, 4, config));
+        }
+        expectTrue(stats, !rtsa::readSweepFile(binPath, [](const SweepBlock&) {}),
+                   "unfinished sweep writer leaves a truncated file");
+
+        // A corrupt row count is rejected before anything is allocated for it.
+        {
+            std::ofstream out(binPath, std::ios::binary | std::ios::trunc);
+            const uint64_t rows = ~uint64_t{0} / 2;
+            out.write(rtsa::kSweepMagic, sizeof(rtsa::kSweepMagic));
+            out.write(reinterpret_cast<const char*>(&rtsa::kSweepVersion), sizeof(rtsa::kSweepVersion));
+            out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+        }
+        expectTrue(stats, !rtsa::convertSweepToCsv(binPath, csvPath),
+                   "sweep file with an oversized row count is rejected");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        const std::string objPath = (std::filesystem::temp_directory_path() / "rtsa_test_plate.obj").string();
+        {
+            std::ofstream obj(objPath);
+            obj << "# 2x2 plate as one quad\n"
+                << "v 0 -1 -1\nv 0 1 -1\nv 0 1 1\nv 0 -1 1\n"
+                << "f 1/1/1 2/2/1 3/3/1 -1/4/1\n";
+        }
+        Mesh loaded;
+        bool ok = Mesh::loadObj(objPath, loaded);
+        expectTrue(stats, ok && loaded.indices.size() == 2, "OBJ quad loads as two triangles");
+        double area = estimator.estimateFrontalArea(loaded, wind, samples);
+        expectNear(stats, area, 4.0, 0.2, "OBJ plate frontal area along +X");
+        std::filesystem::remove(objPath);
+        expectTrue(stats, !Mesh::loadObj(objPath, loaded), "missing OBJ file fails to load");
+    }
+
+#ifndef _WIN32
+    {
+        // Coordinator plus workers on threads of this process. A raw client
+        // takes a unit and hangs up without answering, so that unit must be
+        // retried by the real workers.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard.bin").string();
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {"", ""};
+        config.sweep.directions = 150;
+        config.sweep.samples = 32;
+        config.sweep.speed = 5.0;
+        config.unitRows = 20;
+        config.idleTimeoutSec = 5.0;
+
+        SweepWriter writer(binPath);
+        bool coordinatorOk = false;
+        std::thread coordinatorThread([&]() { coordinatorOk = rtsa::runCoordinator(config, writer); });
+
+        bool dropped = grabUnitAndHangUp(socketPath);
+        rtsa::WorkerConfig steady;
+        steady.socketPath = socketPath;
+        steady.connectTimeoutSec = 1.0; // late starters may find the sweep already done
+        std::vector<std::thread> workers;
+        for (int w = 0; w < 3; ++w) {
+            workers.emplace_back([&]() { rtsa::runWorker(steady, estimator); });
+        }
+        for (auto& t : workers) t.join();
+        coordinatorThread.join();
+        bool finished = writer.finish();
+
+        expectTrue(stats, dropped, "raw client receives a unit before hanging up");
+        expectTrue(stats, coordinatorOk && finished, "sharded sweep completes");
+        expectTrue(stats, shardOutputMatches(estimator, binPath, config.sweep, 2),
+                   "sharded sweep merges deterministically");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // Real worker processes: this binary re-executed in --worker mode.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_proc.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_proc.bin").string();
+        const std::string self = rtsa::currentExecutablePath(argv[0]);
+        expectTrue(stats, std::filesystem::path(self).is_absolute() && std::filesystem::exists(self),
+                   "current executable path is absolute and exists");
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {"", ""};
+        config.sweep.directions = 90;
+        config.sweep.samples = 32;
+        config.sweep.speed = 5.0;
+        config.unitRows = 16;
+        config.idleTimeoutSec = 10.0;
+        config.workerCommand = {self, "--worker", "--socket", socketPath};
+        config.localWorkers = 3;
+
+        SweepWriter writer(binPath);
+        bool coordinatorOk = rtsa::runCoordinator(config, writer);
+        bool finished = writer.finish();
+        expectTrue(stats, coordinatorOk && finished, "sharded sweep with worker processes completes");
+        expectTrue(stats, shardOutputMatches(estimator, binPath, config.sweep, 2),
+                   "worker processes merge deterministically");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // More local workers than units: most connect after the last result
+        // and must still be told Done instead of blocking the shutdown.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_late.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_late.bin").string();
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {""};
+        config.sweep.directions = 3;
+        config.sweep.samples = 4;
+        config.unitRows = 1;
+        config.idleTimeoutSec = 20.0;
+        config.workerCommand = {rtsa::currentExecutablePath(argv[0]), "--worker", "--socket", socketPath};
+        config.localWorkers = 12;
+
+        bool allOk = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int run = 0; run < 5; ++run) {
+            SweepWriter writer(binPath);
+            bool coordinatorOk = rtsa::runCoordinator(config, writer);
+            allOk = allOk && coordinatorOk && writer.finish() &&
+                    shardOutputMatches(estimator, binPath, config.sweep, 1);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        expectTrue(stats, allOk && seconds < 15.0, "late worker processes do not stall the coordinator");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // A worker slower than the unit timeout stays assigned as long as its
+        // heartbeats arrive; a single timeout would fail the run.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_slow.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_slow.bin").string();
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {""};
+        config.sweep.directions = 8;
+        config.sweep.samples = 16;
+        config.unitRows = 4;
+        config.unitTimeoutSec = 0.4;
+        config.maxAttempts = 1;
+        config.idleTimeoutSec = 5.0;
+
+        SlowEstimator slow(estimator, std::chrono::milliseconds(250));
+        SweepWriter writer(binPath);
+        bool coordinatorOk = false;
+        std::thread coordinatorThread([&]() { coordinatorOk = rtsa::runCoordinator(config, writer); });
+        rtsa::WorkerConfig workerConfig;
+        workerConfig.socketPath = socketPath;
+        workerConfig.connectTimeoutSec = 1.0;
+        std::vector<std::thread> workers;
+        for (int w = 0; w < 2; ++w) {
+            workers.emplace_back([&]() { rtsa::runWorker(workerConfig, slow); });
+        }
+        for (auto& t : workers) t.join();
+        coordinatorThread.join();
+        bool finished = writer.finish();
+        expectTrue(stats, coordinatorOk && finished, "slow worker with heartbeats is not timed out");
+        expectTrue(stats, shardOutputMatches(estimator, binPath, config.sweep, 1),
+                   "slow worker results merge deterministically");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // Workers that cannot be executed make the coordinator fail fast
+        // rather than wait out the idle timeout.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_noexec.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_noexec.bin").string();
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {""};
+        config.sweep.directions = 10;
+        config.sweep.samples = 8;
+        config.idleTimeoutSec = 60.0;
+        config.workerCommand = {"/nonexistent/rtsa-worker"};
+        config.localWorkers = 2;
+
+        SweepWriter writer(binPath);
+        auto start = std::chrono::steady_clock::now();
+        bool coordinatorOk = rtsa::runCoordinator(config, writer);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        writer.finish();
+        expectTrue(stats, !coordinatorOk && seconds < 10.0, "coordinator fails fast when workers cannot start");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // Something that is not a socket at the socket path is never deleted.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_regular.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_regular.bin").string();
+        std::ofstream(socketPath) << "keep me\n";
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {""};
+        config.sweep.directions = 10;
+
+        SweepWriter writer(binPath);
+        bool coordinatorOk = rtsa::runCoordinator(config, writer);
+        writer.finish();
+        expectTrue(stats, !coordinatorOk, "coordinator refuses a non-socket path");
+        expectTrue(stats, std::filesystem::is_regular_file(socketPath),
+                   "non-socket file at the socket path survives");
+        std::filesystem::remove(socketPath);
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // Unreadable meshes are rejected before any worker is involved.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string binPath = (dir / "rtsa_test_shard_nomesh.bin").string();
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = (dir / "rtsa_test_shard_nomesh.sock").string();
+        config.meshPaths = {(dir / "rtsa_missing_mesh.obj").string()};
+        config.sweep.directions = 10;
+        config.idleTimeoutSec = 60.0;
+
+        SweepWriter writer(binPath);
+        bool coordinatorOk = rtsa::runCoordinator(config, writer);
+        writer.finish();
+        expectTrue(stats, !coordinatorOk, "sharded sweep rejects a missing mesh up front");
+        std::filesystem::remove(binPath);
+    }
+
+    {
+        // A mesh no worker can parse exhausts its retries instead of hanging.
+        const auto dir = std::filesystem::temp_directory_path();
+        const std::string socketPath = (dir / "rtsa_test_shard_fail.sock").string();
+        const std::string binPath = (dir / "rtsa_test_shard_fail.bin").string();
+        const std::string objPath = (dir / "rtsa_test_broken.obj").string();
+        std::ofstream(objPath) << "v 1 2\n";
+
+        rtsa::CoordinatorConfig config;
+        config.socketPath = socketPath;
+        config.meshPaths = {"", objPath}; // the cube's unit completes first
+        config.sweep.directions = 10;
+        config.sweep.samples = 8;
+        config.maxAttempts = 2;
+        config.idleTimeoutSec = 2.0;
+
+        SweepWriter writer(binPath);
+        bool coordinatorOk = true;
+        std::thread coordinatorThread([&]() { coordinatorOk = rtsa::runCoordinator(config, writer); });
+        rtsa::WorkerConfig workerConfig;
+        workerConfig.socketPath = socketPath;
+        workerConfig.connectTimeoutSec = 1.0;
+        std::vector<std::thread> workers;
+        for (int w = 0; w < 3; ++w) {
+            workers.emplace_back([&]() { rtsa::runWorker(workerConfig, estimator); });
+        }
+        for (auto& t : workers) t.join();
+        coordinatorThread.join();
+        writer.abandon();
+        expectTrue(stats, !coordinatorOk, "sharded sweep gives up after max attempts");
+        expectTrue(stats, !rtsa::readSweepFile(binPath, [](const SweepBlock&) {}),
+                   "abandoned sharded sweep reads back as truncated");
+        std::filesystem::remove(objPath);
+        std::filesystem::remove(binPath);
+    }
+#endif
+
     if (stats.failed == 0) {
         std::cout << "[OK] " << stats.passed << " tests passed.\n";
         return 0;